@@ -0,0 +1,126 @@
+#!/bin/sh
+#This script compares the formulations and engines of the ILP against the baseline ILP on small instances.
+#------------------------------------------------
+#File Name: CompareModes.sh
+#Author: Qihan Zhang
+#Email: lengkudaodi@outlook.com
+#Last Modified: Jun. 30th 2021
+#------------------------------------------------
+#
+#Usage: sh CompareModes.sh <Program> [<Number of Traffic>] [<Number of Cores>]
+#
+#<Program> is the program built with CPLEX. The first <Number of Traffic> requests (6 by default) of the shipped traffic
+#files are solved over <Number of Cores> cores (2 by default) of the 6-vertex topologies for TDM, WDM and OFDM, first by the
+#baseline ILP and then by each mode of the list below. An exact mode must reach the objective of the baseline and a heuristic
+#one must find a solution not below it. A mode of -aggregate 1 must also build the request ordering rows when the traffic has
+#duplicate requests, and the arc-flow one must have more rows than the baseline. The script exits with 1 if a mode fails, the
+#runs are kept in a temporary folder.
+
+Program=$(cd "$(dirname "$1")" && pwd)/$(basename "$1")
+RNum=${2:-6}
+CoreNum=${3:-2}
+Folder=$(cd "$(dirname "$0")/.." && pwd)
+Work=$(mktemp -d)
+Failed=0
+
+#The modes are listed as <Types>;<Relation>;<Arguments>, where <Types> are the types of traffic the mode is compared on and
+#    <Relation> is = for an exact mode or >= for a heuristic one. The global offsets of WDM and OFDM add the spectrum consistency
+#    which the baseline does not have, so they may only raise its objective:
+Modes="
+0 1 2;=;-overlap 1
+0 1 2;=;-start 1
+0 1 2;=;-window $RNum
+0 1 2;>=;-window 2 -reopt 1
+0 1 2;=;-batch 2
+0;=;-slot 1
+0;=;-offset 1
+1 2;>=;-offset 1
+1 2;>=;-offset 1 -start 1
+0 1 2;=;-symmetry 1
+0 1 2;=;-symmetry 1 -start 1
+0 1 2;=;-aggregate 1
+0 1 2;>=;-aggregate 1 -path 3
+0 1 2;>=;-engine 6
+0 1 2;>=;-engine 6 -rounds 0
+"
+
+#Print the objective of a run, or nothing when it has no solution:
+Solve()
+{
+	Type=$1
+	Name=$2
+	shift 2
+	case $Type in
+		0) Topo=TDMN6S8.txt; Traffic=tdm1000.txt;;
+		1) Topo=WDMN6S8.txt; Traffic=wdm5000.txt;;
+		*) Topo=OFDMN6S8.txt; Traffic=ofdm5000.txt;;
+	esac
+	(cd "$Work" && "$Program" -type "$Type" -topo "$Folder/$Topo" -rnum "$RNum" -traffic "$Folder/$Traffic" -cnum "$CoreNum" \
+		-export 0 "$@" > "$Name.txt" 2>&1)
+	sed -n 's/^Solution Objective Value Maximum M = //p' "$Work/$Name.txt" | tail -n 1
+}
+
+#Print the number after "<Name> = " in the last line of a run holding it, or 0 when no line holds it:
+Value()
+{
+	Count=$(sed -n "s/.*$2 = \([0-9]*\).*/\1/p" "$Work/$1.txt" | tail -n 1)
+	echo "${Count:-0}"
+}
+
+for Type in 0 1 2
+do
+	Baseline=$(Solve "$Type" "Baseline$Type")
+	if [ -z "$Baseline" ]
+	then
+		echo "Type $Type: the baseline has no solution, see $Work/Baseline$Type.txt"
+		Failed=1
+		continue
+	fi
+	echo "Type $Type: baseline objective = $Baseline"
+
+	Number=0
+	echo "$Modes" | while IFS=';' read -r Types Relation Arguments
+	do
+		[ -z "$Arguments" ] && continue
+		Number=$((Number + 1))
+		case " $Types " in
+			*" $Type "*) ;;
+			*) continue;;
+		esac
+
+		Objective=$(Solve "$Type" "Mode$Type-$Number" $Arguments)
+		if [ -z "$Objective" ]
+		then
+			Result="FAILED, no solution"
+		elif [ "$Relation" = "=" ] && awk "BEGIN { exit !($Objective == $Baseline) }"
+		then
+			Result="ok"
+		elif [ "$Relation" = ">=" ] && awk "BEGIN { exit !($Objective >= $Baseline) }"
+		then
+			Result="ok"
+		else
+			Result="FAILED, not $Relation $Baseline"
+		fi
+		case "$Result $Arguments " in
+			"ok "*"-aggregate 1 "*)
+				if [ "$(Value "Mode$Type-$Number" "Duplicate Requests")" -gt 0 ]
+				then
+					if [ "$(Value "Mode$Type-$Number" "Request Ordering Constraints")" -eq 0 ]
+					then
+						Result="FAILED, no request ordering rows"
+					fi
+					case " $Arguments " in
+						*" -path "*) ;;
+						*) [ "$(Value "Mode$Type-$Number" "Model Rows")" -gt "$(Value "Baseline$Type" "Model Rows")" ] ||
+							Result="FAILED, no more rows than the baseline";;
+					esac
+				fi;;
+		esac
+		echo "    $Arguments: objective = $Objective ($Relation): $Result"
+		case $Result in
+			FAILED*) echo "        see $Work/Mode$Type-$Number.txt"; exit 1;;
+		esac
+	done || Failed=1
+done
+
+exit $Failed
@@ -0,0 +1,132 @@
+//This file is the microbenchmark of the memory-mapped from_chars parser of class TrafficLoader against the stream input.
+//------------------------------------------------
+//File Name: LoaderBenchmark.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+//Build it in the folder TDMWDMOFDMonMCF without CPLEX:
+//    g++ -O2 -std=c++17 -I. Benchmark/LoaderBenchmark.cpp Loader.cpp Request.cpp -o LoaderBenchmark
+//Run it with the numbers of requests of the generated traffic files, 100000 and 1000000 by default:
+//    ./LoaderBenchmark 100000 1000000
+
+#include "Loader.h"
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <random>
+#include <string>
+
+namespace
+{
+	bool writeTraffic(const string& TrafficFileName, const int Request_Number);
+	//Postcondition: Return false if the file fails to open, otherwise the file holds Request_Number random OFDM requests
+	//    "Source Destination 2 Slots" over 14 vertexes and 1 to 32 slots, drawn from a fixed seed
+
+	bool isSameTable(const VONERequest::RequestTable& FirstRequests, const VONERequest::RequestTable& SecondRequests);
+	//Postcondition: Return true if both tables hold the same requests in the same order
+}
+
+int main(int argc, char **argv)
+{
+	vector<int> Request_Number;
+	for (int i = 1; i < argc; i++)
+	{
+		Request_Number.push_back(stoi(argv[i]));
+	}
+	if (Request_Number.empty())
+	{
+		Request_Number.push_back(100000);
+		Request_Number.push_back(1000000);
+	}
+
+	const string TrafficFileName = "LoaderBenchmarkTraffic.txt";
+	for (vector<int>::const_iterator NumberIT = Request_Number.begin(); NumberIT != Request_Number.end(); NumberIT++)
+	{
+		if (!writeTraffic(TrafficFileName, *NumberIT))
+		{
+			cerr << "File " << TrafficFileName << " opening failed.\n";
+			return 1;
+		}
+
+		//Each parser runs once to warm up the page cache and then 5 times, the fastest run is reported:
+		VONELoader::TrafficLoader Mapped_Loader, Stream_Loader;
+		double Mapped_Time = 1e300, Stream_Time = 1e300;
+		int Error = 0;
+		for (int Run = 0; (Run <= 5) && (Error == 0); Run++)
+		{
+			VONELoader::TrafficLoader Mapped, Stream;
+			chrono::steady_clock::time_point start = chrono::steady_clock::now();
+			Error = Mapped.load(TrafficFileName, 2, *NumberIT);
+			chrono::steady_clock::time_point middle = chrono::steady_clock::now();
+			Error = Error != 0 ? Error : Stream.load_stream(TrafficFileName, 2, *NumberIT);
+			chrono::steady_clock::time_point end = chrono::steady_clock::now();
+			if (Run > 0)
+			{
+				Mapped_Time = min(Mapped_Time, chrono::duration<double, milli>(middle - start).count());
+				Stream_Time = min(Stream_Time, chrono::duration<double, milli>(end - middle).count());
+			}
+			Mapped_Loader = Mapped;
+			Stream_Loader = Stream;
+		}
+		remove(TrafficFileName.c_str());
+		if (Error != 0)
+		{
+			cerr << "The traffic file fails to load, error " << Error << ".\n";
+			return 1;
+		}
+
+		const VONERequest::RequestTable& Mapped_Requests = Mapped_Loader.get_request();
+		bool Same = isSameTable(Mapped_Requests, Stream_Loader.get_request())
+			&& (static_cast<int>(Mapped_Requests.size()) == *NumberIT);
+		cout << "R = " << *NumberIT << ": from_chars = " << Mapped_Time << "ms (" << *NumberIT / Mapped_Time / 1e3
+			<< " M requests/s), stream = " << Stream_Time << "ms (" << *NumberIT / Stream_Time / 1e3 << " M requests/s), speedup = "
+			<< Stream_Time / Mapped_Time << ", tables " << (Same ? "match" : "differ") << endl;
+		if (!Same)
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+namespace
+{
+	bool writeTraffic(const string& TrafficFileName, const int Request_Number)
+	{
+		ofstream trafficoutput(TrafficFileName.c_str());
+		if (trafficoutput.fail())
+		{
+			return false;
+		}
+		mt19937 Generator(1);
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			int Source = 1 + static_cast<int>(Generator() % 14);
+			int Destination = 1 + static_cast<int>(Generator() % 13);
+			Destination = Destination >= Source ? Destination + 1 : Destination;
+			trafficoutput << Source << ' ' << Destination << ' ' << 2 << ' ' << 1 + Generator() % 32 << '\n';
+		}
+		return !trafficoutput.fail();
+	}
+
+	bool isSameTable(const VONERequest::RequestTable& FirstRequests, const VONERequest::RequestTable& SecondRequests)
+	{
+		if (FirstRequests.size() != SecondRequests.size())
+		{
+			return false;
+		}
+		for (size_t r = 0; r < FirstRequests.size(); r++)
+		{
+			if ((FirstRequests.get_source(r) != SecondRequests.get_source(r))
+				|| (FirstRequests.get_destination(r) != SecondRequests.get_destination(r))
+				|| (FirstRequests.get_type(r) != SecondRequests.get_type(r)) || (FirstRequests.get_width(r) != SecondRequests.get_width(r)))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
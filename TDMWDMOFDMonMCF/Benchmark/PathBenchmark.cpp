@@ -0,0 +1,143 @@
+//This file is the microbenchmark of class PathCache against computing the paths of every request again.
+//------------------------------------------------
+//File Name: PathBenchmark.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+//Build it in the folder TDMWDMOFDMonMCF without CPLEX:
+//    g++ -O2 -std=c++17 -pthread -I. Benchmark/PathBenchmark.cpp Path.cpp Topo.cpp Request.cpp Loader.cpp -o PathBenchmark
+//Run it with the number of vertexes of the ring and chord topology, the number of requests and the numbers of threads,
+//    100 vertexes, 100000 requests and 1, 2 and 4 threads by default:
+//    ./PathBenchmark 100 100000 1 2 4
+
+#include "Path.h"
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace
+{
+	const int Recompute_Number = 2000;
+
+	string getTopology(const int Vertex_Number);
+	//Postcondition: Return the topology file of a ring of Vertex_Number vertexes and a chord from every vertex of its first
+	//    half to the opposite vertex
+
+	bool isSamePaths(const VONEPath::PathList& FirstPaths, const VONEPath::PathList& SecondPaths);
+	//Postcondition: Return true if both lists hold the same paths in the same order
+}
+
+int main(int argc, char **argv)
+{
+	int Vertex_Number = argc > 1 ? max(stoi(argv[1]), 4) : 100;
+	int Request_Number = argc > 2 ? stoi(argv[2]) : 100000;
+	vector<int> Thread_Number;
+	for (int i = 3; i < argc; i++)
+	{
+		Thread_Number.push_back(stoi(argv[i]));
+	}
+	if (Thread_Number.empty())
+	{
+		Thread_Number.push_back(1);
+		Thread_Number.push_back(2);
+		Thread_Number.push_back(4);
+	}
+
+	istringstream topoinput(getTopology(Vertex_Number));
+	VONETopo::Topo Topology;
+	topoinput >> Topology;
+
+	//The requests repeat the vertex pairs as the traffic files do, from a fixed seed:
+	mt19937 Generator(1);
+	VONERequest::RequestTable Requests;
+	for (int r = 1; r <= Request_Number; r++)
+	{
+		int Source = 1 + static_cast<int>(Generator() % Vertex_Number);
+		int Destination = 1 + static_cast<int>(Generator() % (Vertex_Number - 1));
+		Destination = Destination >= Source ? Destination + 1 : Destination;
+		Requests.add(Source, Destination, 2, 1 + static_cast<int>(Generator() % 32));
+	}
+	const int Recompute_Count = min(Request_Number, Recompute_Number);
+
+	for (int K = 1; K <= 3; K += 2)
+	{
+		//The paths of the first requests are computed again for each request, the time is per request:
+		VONEPath::PathFinder Finder(Topology);
+		vector<VONEPath::PathList> Recomputed(Recompute_Count);
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		for (int r = 0; r < Recompute_Count; r++)
+		{
+			Finder.get_k_shortest_paths(Requests.get_source(r), Requests.get_destination(r), K, Recomputed[r]);
+		}
+		double Recompute_Time = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count() / Recompute_Count;
+		cout << "V = " << Vertex_Number << ", R = " << Request_Number << ", k = " << K << ": computing again = "
+			<< Recompute_Time * Request_Number << "ms (estimated from " << Recompute_Count << " requests)" << endl;
+
+		//The cache computes each pair once, and every request looks its paths up:
+		for (vector<int>::const_iterator ThreadIT = Thread_Number.begin(); ThreadIT != Thread_Number.end(); ThreadIT++)
+		{
+			VONEPath::PathCache Cache(Topology, K);
+			start = chrono::steady_clock::now();
+			Cache.compute(Requests, *ThreadIT);
+			size_t Path_Number = 0;
+			for (int r = 0; r < Request_Number; r++)
+			{
+				Path_Number += Cache.get_paths(Requests.get_source(r), Requests.get_destination(r)).size();
+			}
+			double Cache_Time = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+
+			long long Mismatch = 0;
+			for (int r = 0; r < Recompute_Count; r++)
+			{
+				Mismatch += isSamePaths(Recomputed[r], Cache.get_paths(Requests.get_source(r), Requests.get_destination(r))) ? 0 : 1;
+			}
+			cout << "    cache of " << *ThreadIT << " threads = " << Cache_Time << "ms for " << Path_Number << " paths, speedup = "
+				<< Recompute_Time * Request_Number / Cache_Time << ", mismatches = " << Mismatch << endl;
+			cout << "    " << Cache;
+			if (Mismatch != 0)
+			{
+				return 1;
+			}
+		}
+	}
+
+	return 0;
+}
+
+namespace
+{
+	string getTopology(const int Vertex_Number)
+	{
+		ostringstream topooutput;
+		int Link_ID = 0;
+		for (int v = 1; v <= Vertex_Number; v++)
+		{
+			topooutput << ++Link_ID << ' ' << v << ' ' << v % Vertex_Number + 1 << " 0 0 320\n";
+		}
+		for (int v = 1; v <= Vertex_Number / 2; v++)
+		{
+			topooutput << ++Link_ID << ' ' << v << ' ' << v + Vertex_Number / 2 << " 0 0 320\n";
+		}
+		return topooutput.str();
+	}
+
+	bool isSamePaths(const VONEPath::PathList& FirstPaths, const VONEPath::PathList& SecondPaths)
+	{
+		if (FirstPaths.size() != SecondPaths.size())
+		{
+			return false;
+		}
+		for (size_t i = 0; i < FirstPaths.size(); i++)
+		{
+			if ((FirstPaths[i]._vertex != SecondPaths[i]._vertex) || (FirstPaths[i]._link != SecondPaths[i]._link)
+				|| (FirstPaths[i]._direction != SecondPaths[i]._direction))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
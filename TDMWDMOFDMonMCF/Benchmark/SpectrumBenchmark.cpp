@@ -0,0 +1,226 @@
+//This file is the microbenchmark of the word-parallel first-fit of class SpectrumOccupancy against a byte-per-slot scan.
+//------------------------------------------------
+//File Name: SpectrumBenchmark.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+//Build it in the folder TDMWDMOFDMonMCF without CPLEX:
+//    g++ -O2 -std=c++17 -I. Benchmark/SpectrumBenchmark.cpp Spectrum.cpp Topo.cpp -o SpectrumBenchmark
+//Run it with the number of queries, 1000000 by default:
+//    ./SpectrumBenchmark 1000000
+
+#include "Spectrum.h"
+#include <chrono>
+#include <random>
+#include <string>
+
+namespace
+{
+	const int Link_Number = 22;
+	const int Core_Number = 7;
+	const int Slot_Number = 320;
+	const int Path_Length = 3;
+	const int Largest_Width = 32;
+
+	//A query of the benchmark: Width free slots on the same core of Path_Length links
+	struct Query
+	{
+		int _link[Path_Length];
+		int _direction[Path_Length];
+		int _core;
+		int _width;
+	};
+
+	void occupy(VONESpectrum::SpectrumOccupancy& Occupancy, vector<vector<unsigned char> >& Slot, const double Ratio, mt19937& Generator);
+	//Postcondition: About Ratio of the slots of every core of every link in each direction are occupied by random blocks of 1 to
+	//    Largest_Width slots, in Occupancy and in Slot, whose byte (Slot_Number * core + slot - 1) of the row 2 * (link - 1) +
+	//    direction is 1 if the slot is occupied
+
+	int scanFirstFit(const vector<vector<unsigned char> >& Slot, const Query& Request);
+	//Postcondition: Return the lowest start of Width slots which are free on the core of all links of Request, found by scanning the
+	//    bytes of the slots one by one, or 0 if there is no such block
+
+	int scanFit(const vector<VONESpectrum::SlotWord>& Free, const int Width, const bool Best);
+	//Postcondition: Return the start of the first (or the shortest if Best) run of at least Width 1 bits of Free found bit by bit,
+	//    or 0 if there is no such run
+}
+
+int main(int argc, char **argv)
+{
+	int Query_Number = argc > 1 ? stoi(argv[1]) : 1000000;
+	VONETopo::LinkList Links(Link_Number);
+	for (int sd = 1; sd <= Link_Number; sd++)
+	{
+		Links[sd - 1]._edge_id = sd;
+		Links[sd - 1]._edge_source._vertex_id = sd;
+		Links[sd - 1]._edge_destination._vertex_id = sd + 1;
+		Links[sd - 1]._edge_bandwidth = Slot_Number;
+	}
+
+	mt19937 Generator(1);
+	VONESpectrum::SpectrumOccupancy Occupancy;
+	Occupancy.assign(Links, Core_Number);
+	vector<vector<unsigned char> > Slot(2 * Link_Number, vector<unsigned char>(Core_Number * Slot_Number, 0));
+	occupy(Occupancy, Slot, 0.55, Generator);
+
+	vector<Query> Requests(Query_Number);
+	for (vector<Query>::iterator QueryIT = Requests.begin(); QueryIT != Requests.end(); QueryIT++)
+	{
+		for (int i = 0; i < Path_Length; i++)
+		{
+			QueryIT->_link[i] = 1 + static_cast<int>(Generator() % Link_Number);
+			QueryIT->_direction[i] = static_cast<int>(Generator() % 2);
+		}
+		QueryIT->_core = 1 + static_cast<int>(Generator() % Core_Number);
+		QueryIT->_width = 1 + static_cast<int>(Generator() % Largest_Width);
+	}
+
+	//The path AND and first-fit by words, and the same queries by the byte scan:
+	vector<VONESpectrum::SlotWord> Free, Run;
+	vector<int> Word_Start(Query_Number), Byte_Start(Query_Number);
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+	for (int i = 0; i < Query_Number; i++)
+	{
+		const Query& Request = Requests[i];
+		Occupancy.get_free_slots(Request._link[0], Request._direction[0], Request._core, Free);
+		for (int j = 1; j < Path_Length; j++)
+		{
+			Occupancy.and_free_slots(Request._link[j], Request._direction[j], Request._core, Free);
+		}
+		Word_Start[i] = VONESpectrum::SpectrumOccupancy::first_fit(Free, Request._width, Run);
+	}
+	chrono::steady_clock::time_point middle = chrono::steady_clock::now();
+	for (int i = 0; i < Query_Number; i++)
+	{
+		Byte_Start[i] = scanFirstFit(Slot, Requests[i]);
+	}
+	chrono::steady_clock::time_point end = chrono::steady_clock::now();
+	double Word_Time = chrono::duration<double>(middle - start).count();
+	double Byte_Time = chrono::duration<double>(end - middle).count();
+
+	long long Mismatch = 0;
+	for (int i = 0; i < Query_Number; i++)
+	{
+		Mismatch += Word_Start[i] != Byte_Start[i] ? 1 : 0;
+	}
+
+	//Allocate and release the first-fit blocks of the queries on their first links:
+	long long Pair_Number = 0;
+	start = chrono::steady_clock::now();
+	for (int i = 0; i < Query_Number; i++)
+	{
+		const Query& Request = Requests[i];
+		if (Word_Start[i] > 0)
+		{
+			Occupancy.allocate(Request._link[0], Request._direction[0], Request._core, Word_Start[i], Request._width);
+			Occupancy.release(Request._link[0], Request._direction[0], Request._core, Word_Start[i], Request._width);
+			Pair_Number++;
+		}
+	}
+	double Pair_Time = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+
+	//first_fit and best_fit of random bitsets against the bit by bit scan:
+	long long Fit_Mismatch = 0;
+	vector<VONESpectrum::SlotWord> Bits((Slot_Number + VONESpectrum::Slot_Word_Bits - 1) / VONESpectrum::Slot_Word_Bits);
+	for (int i = 0; i < 200000; i++)
+	{
+		for (size_t w = 0; w < Bits.size(); w++)
+		{
+			//Sparse, dense and random words give short and long runs:
+			VONESpectrum::SlotWord Word = (static_cast<VONESpectrum::SlotWord>(Generator()) << 32) | Generator();
+			int Kind = static_cast<int>(Generator() % 3);
+			Bits[w] = Kind == 0 ? Word : (Kind == 1 ? Word | (Word >> 1) | (Word >> 2) : Word & (Word >> 1));
+		}
+		int Width = 1 + static_cast<int>(Generator() % Largest_Width);
+		Fit_Mismatch += VONESpectrum::SpectrumOccupancy::first_fit(Bits, Width) != scanFit(Bits, Width, false) ? 1 : 0;
+		Fit_Mismatch += VONESpectrum::SpectrumOccupancy::best_fit(Bits, Width) != scanFit(Bits, Width, true) ? 1 : 0;
+	}
+
+	cout << Link_Number << " links x 2 directions x " << Core_Number << " cores x " << Slot_Number << " slots, 55% occupied, "
+		<< Query_Number << " queries of " << Path_Length << "-link paths and widths 1 to " << Largest_Width << endl;
+	cout << "Word path AND + first_fit: " << Query_Number / Word_Time / 1e6 << " M queries/s" << endl;
+	cout << "Byte-per-slot scan: " << Query_Number / Byte_Time / 1e6 << " M queries/s" << endl;
+	cout << "allocate + release: " << Pair_Number / Pair_Time / 1e6 << " M pairs/s" << endl;
+	cout << "Mismatches: path queries = " << Mismatch << ", first_fit/best_fit of 200000 random bitsets = " << Fit_Mismatch << endl;
+
+	return (Mismatch == 0) && (Fit_Mismatch == 0) ? 0 : 1;
+}
+
+namespace
+{
+	void occupy(VONESpectrum::SpectrumOccupancy& Occupancy, vector<vector<unsigned char> >& Slot, const double Ratio, mt19937& Generator)
+	{
+		for (int sd = 1; sd <= Link_Number; sd++)
+		{
+			for (int Direction = 0; Direction <= 1; Direction++)
+			{
+				for (int c = 1; c <= Core_Number; c++)
+				{
+					unsigned char* Core_Slot = &Slot[2 * (sd - 1) + Direction][Slot_Number * (c - 1)];
+					int Occupied = 0;
+					for (int Try = 0; (Try < 10000) && (Occupied < Ratio * Slot_Number); Try++)
+					{
+						int Width = 1 + static_cast<int>(Generator() % Largest_Width);
+						int Start = 1 + static_cast<int>(Generator() % (Slot_Number - Width + 1));
+						if (Occupancy.is_free(sd, Direction, c, Start, Width))
+						{
+							Occupancy.allocate(sd, Direction, c, Start, Width);
+							fill(Core_Slot + Start - 1, Core_Slot + Start - 1 + Width, 1);
+							Occupied += Width;
+						}
+					}
+				}
+			}
+		}
+	}
+
+	int scanFirstFit(const vector<vector<unsigned char> >& Slot, const Query& Request)
+	{
+		int Run_Length = 0;
+		for (int slot = 1; slot <= Slot_Number; slot++)
+		{
+			bool Free = true;
+			for (int i = 0; (i < Path_Length) && Free; i++)
+			{
+				Free = Slot[2 * (Request._link[i] - 1) + Request._direction[i]][Slot_Number * (Request._core - 1) + slot - 1] == 0;
+			}
+			Run_Length = Free ? Run_Length + 1 : 0;
+			if (Run_Length == Request._width)
+			{
+				return slot - Request._width + 1;
+			}
+		}
+		return 0;
+	}
+
+	int scanFit(const vector<VONESpectrum::SlotWord>& Free, const int Width, const bool Best)
+	{
+		int Bit_Number = static_cast<int>(Free.size()) * VONESpectrum::Slot_Word_Bits;
+		int Fit_Start = 0, Fit_Length = 0, Run_Start = 0;
+		for (int i = 0; i <= Bit_Number; i++)
+		{
+			bool Bit = (i < Bit_Number) && ((Free[i / VONESpectrum::Slot_Word_Bits] >> (i % VONESpectrum::Slot_Word_Bits)) & 1);
+			if (Bit && (Run_Start == 0))
+			{
+				Run_Start = i + 1;
+			}
+			else if (!Bit && (Run_Start > 0))
+			{
+				int Length = i + 1 - Run_Start;
+				if ((Length >= Width) && ((Fit_Start == 0) || (Best && (Length < Fit_Length))))
+				{
+					Fit_Start = Run_Start;
+					Fit_Length = Length;
+					if (!Best)
+					{
+						return Fit_Start;
+					}
+				}
+				Run_Start = 0;
+			}
+		}
+		return Fit_Start;
+	}
+}
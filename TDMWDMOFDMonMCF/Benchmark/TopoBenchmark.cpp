@@ -0,0 +1,164 @@
+//This file is the microbenchmark of the hashed lookups and the incidence lists of class Topo against the linear scans.
+//------------------------------------------------
+//File Name: TopoBenchmark.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+//Build it in the folder TDMWDMOFDMonMCF without CPLEX:
+//    g++ -O2 -std=c++17 -I. Benchmark/TopoBenchmark.cpp Topo.cpp -o TopoBenchmark
+//Run it with the numbers of vertexes of the ring and chord topologies, 1000, 10000 and 100000 by default:
+//    ./TopoBenchmark 1000 10000 100000
+
+#include "Topo.h"
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <sstream>
+#include <string>
+
+namespace
+{
+	const int Query_Number = 100000;
+	const int Scan_Query_Number = 2000;
+	const int Scan_Vertex_Number = 1000;
+
+	string getTopology(const int Vertex_Number);
+	//Postcondition: Return the topology file of a ring of Vertex_Number vertexes and a chord from every vertex of its first
+	//    half to the opposite vertex, so there are about 1.5 edges per vertex
+
+	long long scanIncidence(const VONETopo::LinkList& Edges, const int VertexID);
+	//Postcondition: Return the sum of the positions (starting from 1) of the edges of VertexID, each out edge counted
+	//    positive and each in edge negative, found by scanning all edges as the flow conservation did
+
+	long long getIncidence(const VONETopo::Adjacency& Incidence, const int Position);
+	//Postcondition: Return the same sum as scanIncidence for the vertex at Position of the NodeList from its incidence lists
+}
+
+int main(int argc, char **argv)
+{
+	vector<int> Vertex_Number;
+	for (int i = 1; i < argc; i++)
+	{
+		Vertex_Number.push_back(stoi(argv[i]));
+	}
+	if (Vertex_Number.empty())
+	{
+		Vertex_Number.push_back(1000);
+		Vertex_Number.push_back(10000);
+		Vertex_Number.push_back(100000);
+	}
+
+	for (vector<int>::const_iterator NumberIT = Vertex_Number.begin(); NumberIT != Vertex_Number.end(); NumberIT++)
+	{
+		const int N = max(*NumberIT, 4);
+		istringstream topoinput(getTopology(N));
+		VONETopo::Topo Topology;
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		topoinput >> Topology;
+		double Load_Time = chrono::duration<double, milli>(chrono::steady_clock::now() - start).count();
+		VONETopo::NodeList Vertexes;
+		VONETopo::LinkList Edges;
+		Topology.get_vertex(Vertexes);
+		Topology.get_edge(Edges);
+
+		//Random vertex pairs, about half of which are edges:
+		mt19937 Generator(1);
+		vector<int> Source(Query_Number), Destination(Query_Number);
+		for (int i = 0; i < Query_Number; i++)
+		{
+			Source[i] = 1 + static_cast<int>(Generator() % N);
+			Destination[i] = i % 2 == 0 ? Source[i] % N + 1 : 1 + static_cast<int>(Generator() % N);
+		}
+
+		//The hashed find_edge for all queries and the linear find_if for the first ones, the times are per query:
+		long long Mismatch = 0;
+		vector<int> Hashed(Query_Number);
+		start = chrono::steady_clock::now();
+		for (int i = 0; i < Query_Number; i++)
+		{
+			Hashed[i] = Topology.find_edge(Source[i], Destination[i]);
+		}
+		double Hash_Time = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / Query_Number;
+		start = chrono::steady_clock::now();
+		for (int i = 0; i < Scan_Query_Number; i++)
+		{
+			VONETopo::LinkListIT EdgeIT = find_if(Edges.begin(), Edges.end(), VONETopo::Edge_finder(Source[i], Destination[i]));
+			int Position = EdgeIT == Edges.end() ? -1 : static_cast<int>(EdgeIT - Edges.begin());
+			Mismatch += Position != Hashed[i] ? 1 : 0;
+		}
+		double Scan_Time = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / Scan_Query_Number;
+
+		//The incidence sums of all vertexes from the lists and of the first vertexes by the scan, the times are per vertex:
+		const VONETopo::Adjacency& Incidence = Topology.get_adjacency();
+		const int Vertex_Count = static_cast<int>(Vertexes.size());
+		const int Scan_Count = min(Vertex_Count, Scan_Vertex_Number);
+		vector<long long> Listed(Vertex_Count);
+		start = chrono::steady_clock::now();
+		for (int v = 0; v < Vertex_Count; v++)
+		{
+			Listed[v] = getIncidence(Incidence, v);
+		}
+		double List_Time = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / Vertex_Count;
+		start = chrono::steady_clock::now();
+		for (int v = 0; v < Scan_Count; v++)
+		{
+			Mismatch += scanIncidence(Edges, Vertexes[v]._vertex_id) != Listed[v] ? 1 : 0;
+		}
+		double Edge_Scan_Time = chrono::duration<double, nano>(chrono::steady_clock::now() - start).count() / Scan_Count;
+
+		cout << "V = " << Vertex_Count << ", E = " << Edges.size() << ": load = " << Load_Time << "ms, find_edge = " << Hash_Time
+			<< "ns, find_if = " << Scan_Time << "ns per query; incidence lists = " << List_Time << "ns, edge scan = " << Edge_Scan_Time
+			<< "ns per vertex; mismatches = " << Mismatch << endl;
+		if (Mismatch != 0)
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+namespace
+{
+	string getTopology(const int Vertex_Number)
+	{
+		ostringstream topooutput;
+		int Link_ID = 0;
+		for (int v = 1; v <= Vertex_Number; v++)
+		{
+			topooutput << ++Link_ID << ' ' << v << ' ' << v % Vertex_Number + 1 << " 0 0 320\n";
+		}
+		for (int v = 1; v <= Vertex_Number / 2; v++)
+		{
+			topooutput << ++Link_ID << ' ' << v << ' ' << v + Vertex_Number / 2 << " 0 0 320\n";
+		}
+		return topooutput.str();
+	}
+
+	long long scanIncidence(const VONETopo::LinkList& Edges, const int VertexID)
+	{
+		long long Sum = 0;
+		for (size_t sd = 0; sd < Edges.size(); sd++)
+		{
+			Sum += Edges[sd]._edge_source._vertex_id == VertexID ? static_cast<long long>(sd + 1) : 0;
+			Sum -= Edges[sd]._edge_destination._vertex_id == VertexID ? static_cast<long long>(sd + 1) : 0;
+		}
+		return Sum;
+	}
+
+	long long getIncidence(const VONETopo::Adjacency& Incidence, const int Position)
+	{
+		long long Sum = 0;
+		for (int i = Incidence._out_offset[Position]; i < Incidence._out_offset[Position + 1]; i++)
+		{
+			Sum += Incidence._out_edge[i];
+		}
+		for (int i = Incidence._in_offset[Position]; i < Incidence._in_offset[Position + 1]; i++)
+		{
+			Sum -= Incidence._in_edge[i];
+		}
+		return Sum;
+	}
+}
@@ -0,0 +1,239 @@
+//This file is the microbenchmark of class VarIndex against the inline position expressions it replaced.
+//------------------------------------------------
+//File Name: VarIndexBenchmark.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+//Build it in the folder TDMWDMOFDMonMCF without CPLEX, with -DNDEBUG for the timing and without it for the bounds checks:
+//    g++ -O2 -std=c++17 -DNDEBUG -I. Benchmark/VarIndexBenchmark.cpp Variable.cpp Topo.cpp -o VarIndexBenchmark
+//Run it with the numbers of requests, 1000 and 5000 by default:
+//    ./VarIndexBenchmark 1000 5000
+
+#include "Variable.h"
+#include <chrono>
+#include <random>
+#include <string>
+
+namespace
+{
+	//The positions of the variables of a row of the time slot consistency constraints11
+	struct ConsistencyRow
+	{
+		int _link_1;
+		int _link_2;
+		int _index_1;
+		int _index_2;
+	};
+
+	//The parameters of the ILP of a random instance
+	struct Instance
+	{
+		int _request_number;
+		int _vertex_number;
+		int _edge_number;
+		vector<int> _virtual_vertex_number;
+		vector<int> _accumulate_virtual_vertex_number;
+		vector<int> _virtual_edge_number;
+		vector<int> _accumulate_virtual_edge_number;
+		vector<int> _bandwidth;
+		vector<int> _accumulate_edge_number_and_bandwidth;
+	};
+
+	void getInstance(const int Request_Number, Instance& Parameter);
+	//Postcondition: Parameter holds Request_Number requests of 1 or 2 virtual edges and 1 to 4 time slots over 14 vertexes and
+	//    22 links, drawn from a fixed seed
+
+	void getOldRows(const Instance& Parameter, vector<ConsistencyRow>& Rows);
+	//Postcondition: Rows holds the positions of the rows of constraints11 computed by the inline expressions of the ILP before
+	//    class VarIndex
+
+	void getIndexRows(const Instance& Parameter, const VONEILP::VarIndex& Index, vector<ConsistencyRow>& Rows);
+	//Postcondition: Rows holds the positions of the rows of constraints11 computed by Index
+
+	long long countNodeMismatch(const Instance& Parameter, const VONEILP::VarIndex& Index);
+	//Postcondition: Return the number of the node variables whose position of Index is not the one of the inline expression
+}
+
+int main(int argc, char **argv)
+{
+	vector<int> Request_Number;
+	for (int i = 1; i < argc; i++)
+	{
+		Request_Number.push_back(stoi(argv[i]));
+	}
+	if (Request_Number.empty())
+	{
+		Request_Number.push_back(1000);
+		Request_Number.push_back(5000);
+	}
+
+	for (vector<int>::const_iterator NumberIT = Request_Number.begin(); NumberIT != Request_Number.end(); NumberIT++)
+	{
+		Instance Parameter;
+		getInstance(*NumberIT, Parameter);
+		VONEILP::VarIndex Index;
+		Index.assign(Parameter._request_number, Parameter._vertex_number, Parameter._edge_number, Parameter._virtual_vertex_number,
+			Parameter._accumulate_virtual_vertex_number, Parameter._virtual_edge_number, Parameter._accumulate_virtual_edge_number,
+			Parameter._bandwidth, Parameter._accumulate_edge_number_and_bandwidth, 7);
+
+		//Each way runs once to warm up and then 5 times, the fastest run is reported:
+		vector<ConsistencyRow> Old_Rows, Index_Rows;
+		double Old_Time = 1e300, Index_Time = 1e300;
+		for (int Run = 0; Run <= 5; Run++)
+		{
+			chrono::steady_clock::time_point start = chrono::steady_clock::now();
+			getOldRows(Parameter, Old_Rows);
+			chrono::steady_clock::time_point middle = chrono::steady_clock::now();
+			getIndexRows(Parameter, Index, Index_Rows);
+			chrono::steady_clock::time_point end = chrono::steady_clock::now();
+			if (Run > 0)
+			{
+				Old_Time = min(Old_Time, chrono::duration<double, milli>(middle - start).count());
+				Index_Time = min(Index_Time, chrono::duration<double, milli>(end - middle).count());
+			}
+		}
+
+		long long Mismatch = Old_Rows.size() == Index_Rows.size() ? 0 : -1;
+		for (size_t i = 0; (Mismatch >= 0) && (i < Old_Rows.size()); i++)
+		{
+			Mismatch += ((Old_Rows[i]._link_1 != Index_Rows[i]._link_1) || (Old_Rows[i]._link_2 != Index_Rows[i]._link_2)
+				|| (Old_Rows[i]._index_1 != Index_Rows[i]._index_1) || (Old_Rows[i]._index_2 != Index_Rows[i]._index_2)) ? 1 : 0;
+		}
+		Mismatch = Mismatch < 0 ? Mismatch : Mismatch + countNodeMismatch(Parameter, Index);
+
+		cout << "R = " << *NumberIT << ": constraints11 rows = " << Old_Rows.size() << ", inline expressions = " << Old_Time
+			<< "ms, VarIndex = " << Index_Time << "ms, mismatches = " << Mismatch << endl;
+		if (Mismatch != 0)
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
+
+namespace
+{
+	void getInstance(const int Request_Number, Instance& Parameter)
+	{
+		mt19937 Generator(1);
+		Parameter._request_number = Request_Number;
+		Parameter._vertex_number = 14;
+		Parameter._edge_number = 22;
+		Parameter._virtual_vertex_number.assign(Request_Number, 2);
+		Parameter._accumulate_virtual_vertex_number.resize(Request_Number);
+		Parameter._virtual_edge_number.resize(Request_Number);
+		Parameter._accumulate_virtual_edge_number.resize(Request_Number);
+		Parameter._bandwidth.resize(Request_Number);
+		Parameter._accumulate_edge_number_and_bandwidth.resize(Request_Number);
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			Parameter._virtual_edge_number[r - 1] = 1 + static_cast<int>(Generator() % 2);
+			Parameter._bandwidth[r - 1] = 1 + static_cast<int>(Generator() % 4);
+			Parameter._accumulate_virtual_vertex_number[r - 1] = r == 1 ? 0 :
+				Parameter._accumulate_virtual_vertex_number[r - 2] + Parameter._virtual_vertex_number[r - 2];
+			Parameter._accumulate_virtual_edge_number[r - 1] = r == 1 ? 0 :
+				Parameter._accumulate_virtual_edge_number[r - 2] + Parameter._virtual_edge_number[r - 2];
+			Parameter._accumulate_edge_number_and_bandwidth[r - 1] = r == 1 ? 0 :
+				Parameter._accumulate_edge_number_and_bandwidth[r - 2] + Parameter._virtual_edge_number[r - 2] * Parameter._bandwidth[r - 2];
+		}
+	}
+
+	void getOldRows(const Instance& Parameter, vector<ConsistencyRow>& Rows)
+	{
+		Rows.clear();
+		const int Substrate_Network_Edge_Number = Parameter._edge_number;
+		const vector<int>& Virtual_Networks_Edge_Number = Parameter._virtual_edge_number;
+		const vector<int>& Accumulate_Virtual_Networks_Edge_Number = Parameter._accumulate_virtual_edge_number;
+		const vector<int>& Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth = Parameter._accumulate_edge_number_and_bandwidth;
+		for (int r = 1; r <= Parameter._request_number; r++)
+		{
+			for (int slot = 1; slot <= Parameter._bandwidth[r - 1]; slot++)
+			{
+				for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
+				{
+					for (int sd1 = 1; sd1 <= Substrate_Network_Edge_Number - 1; sd1++)
+					{
+						for (int sd2 = sd1 + 1; sd2 <= Substrate_Network_Edge_Number; sd2++)
+						{
+							for (int d1 = 0; d1 <= 1; d1++)
+							{
+								for (int d2 = 0; d2 <= 1; d2++)
+								{
+									ConsistencyRow Row;
+									Row._link_1 = (2 * (e - 1) + d1)
+										+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
+										+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number;
+									Row._link_2 = (2 * (e - 1) + d2)
+										+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
+										+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number;
+									Row._index_1 = (2 * (e - 1) + d1)
+										+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
+										+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
+										+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth[r - 1];
+									Row._index_2 = (2 * (e - 1) + d2)
+										+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
+										+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
+										+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth[r - 1];
+									Rows.push_back(Row);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void getIndexRows(const Instance& Parameter, const VONEILP::VarIndex& Index, vector<ConsistencyRow>& Rows)
+	{
+		Rows.clear();
+		for (int r = 1; r <= Parameter._request_number; r++)
+		{
+			for (int slot = 1; slot <= Parameter._bandwidth[r - 1]; slot++)
+			{
+				for (int e = 1; e <= Parameter._virtual_edge_number[r - 1]; e++)
+				{
+					for (int sd1 = 1; sd1 <= Parameter._edge_number - 1; sd1++)
+					{
+						for (int sd2 = sd1 + 1; sd2 <= Parameter._edge_number; sd2++)
+						{
+							for (int d1 = 0; d1 <= 1; d1++)
+							{
+								for (int d2 = 0; d2 <= 1; d2++)
+								{
+									ConsistencyRow Row;
+									Row._link_1 = Index.edge(r, e, sd1, d1);
+									Row._link_2 = Index.edge(r, e, sd2, d2);
+									Row._index_1 = Index.slot(r, slot, e, sd1, d1);
+									Row._index_2 = Index.slot(r, slot, e, sd2, d2);
+									Rows.push_back(Row);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	long long countNodeMismatch(const Instance& Parameter, const VONEILP::VarIndex& Index)
+	{
+		long long Mismatch = 0;
+		for (int r = 1; r <= Parameter._request_number; r++)
+		{
+			for (int v = 1; v <= Parameter._virtual_vertex_number[r - 1]; v++)
+			{
+				for (int s = 1; s <= Parameter._vertex_number; s++)
+				{
+					int Position = (v - 1) * Parameter._vertex_number + (s - 1)
+						+ Parameter._accumulate_virtual_vertex_number[r - 1] * Parameter._vertex_number;
+					Mismatch += Index.node(r, v, s) != Position ? 1 : 0;
+				}
+			}
+		}
+		return Mismatch;
+	}
+}
@@ -0,0 +1,692 @@
+//This file defines class VONEColumn
+//------------------------------------------------
+//File Name: Column.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#ifndef VONE_NO_CPLEX
+#include "Column.h"
+
+#include <iomanip>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <limits>
+#include <thread>
+
+namespace
+{
+	//The links of the substrate network in both directions as arcs, the arc 2 * (sd - 1) + d passes the link sd in the direction d
+	//    from _tail[arc] to _head[arc], which are the positions of the vertexes. The arcs leaving the vertex v are _out_arc[_out_offset[v]]
+	//    to _out_arc[_out_offset[v + 1] - 1]
+	struct PricingGraph
+	{
+		int _vertex_number;
+		vector<int> _vertex_id;
+		vector<int> _tail;
+		vector<int> _head;
+		vector<int> _out_offset;
+		vector<int> _out_arc;
+	};
+
+	void getPricingGraph(const VONETopo::Topo& Substrate_Network, PricingGraph& Graph);
+	//Precondition: The topology has been finalized
+	//Postcondition: Graph holds the arcs of the links of the topology
+
+	void getCapacityRows(const int TypeFlag, const int C, const int Slot_Horizon, VONEColumn::Configuration& Column);
+	//Precondition: Column._assignment holds the hops and the spectrum (or time slots) of the configuration, which are at most
+	//    Slot_Horizon
+	//Postcondition: The end index, the hops and the capacity rows of Column have been computed. The row of the slot t of the core c
+	//    of the arc a is ((a * C) + c - 1) * Slot_Horizon + t - 1
+
+	void getBlockPrices(const int TypeFlag, const int C, const int Arc_Number, const int Slot_Horizon, const int Width,
+		const vector<int>& Slot_Number, const vector<double>& Price_Sum, vector<double>& Block_Price, vector<int>& Block_Core,
+		vector<int>& Block_Start);
+	//Precondition: Price_Sum[((a * C) + c - 1) * (Slot_Horizon + 1) + t] is the sum of the dual prices of the slots 1 to t of the
+	//    core c of the arc a, and the arc a has Slot_Number[a] slots
+	//Postcondition: For the end index m = s + Width - 1 of each s from 1 to Slot_Horizon - Width + 1, Block_Price[(s - 1) * Arc_Number + a]
+	//    is the least price of a block of Width slots on one core of the arc a, which is on the core Block_Core and starts at
+	//    Block_Start, or infinity if the arc has no such block. The block of WDM or OFDM ends at m at most, and the time slots of
+	//    TDM are the block from s on all links
+
+	double getShortestPath(const PricingGraph& Graph, const int Source, const int Destination, const int Hop_Limit,
+		const double* Block_Price, vector<double>& Cost, vector<int>& Last_Arc, VONEPath::Path* Route);
+	//Precondition: Source and Destination are the positions of two vertexes, Block_Price holds the price of each arc
+	//    and Cost and Last_Arc are the buffers of the labels
+	//Postcondition: Return the least cost of a path from Source to Destination of at most Hop_Limit hops, where an arc costs 1
+	//    plus its price, or infinity if there is no such path. The path is kept in Route if it is given. The labels are computed
+	//    hop by hop as Bellman-Ford, and a path of the least cost has no loops because each arc costs 1 at least
+}
+
+namespace VONEColumn
+{
+	VONEColumn::VONEColumn() :_type_flag(0), _core_number(0), _initial_column_number(0), _slot_horizon(0), _thread_number(0),
+		_blocked_number(0), _hop_number(0), _max_index(0), _lp_bound(0), _integer_objective(0), _integer_bound(0), _greedy_time(0),
+		_integer_time(0), _solve_time(0)
+	{
+
+	}
+
+	void VONEColumn::solve(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests,
+		int TypeFlag, int CoreNum, const VONEILP::ILPOption& Option)
+	{
+		chrono::steady_clock::time_point solve_start = chrono::steady_clock::now();
+		_type_flag = TypeFlag;
+		_core_number = CoreNum;
+		Substrate_Network.get_edge(_edge);
+		_column.clear();
+		_round.clear();
+
+		int Request_Number = static_cast<int>(Requests.size());
+		int Arc_Number = 2 * static_cast<int>(_edge.size());
+		_assignment.assign(Request_Number, vector<VONEGreedy::EdgeAssignment>());
+		_bandwidth.assign(Request_Number, 0);
+		int Lowest_Index = 0, Highest_Width = 0;
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			_bandwidth[r - 1] = Requests.get_width(r - 1);
+			Highest_Width = max(Highest_Width, _bandwidth[r - 1]);
+			if (TypeFlag != 0)
+			{
+				Lowest_Index = max(Lowest_Index, _bandwidth[r - 1] - 1);
+			}
+		}
+
+		//The greedy solution is the first columns, and a solution with a higher index than it is worse than it since it routes
+		//    each request on a shortest path, so its highest index is the slot horizon if no request is blocked, otherwise the
+		//    horizon is the most slots of a link:
+		VONEPath::PathCache Paths(Substrate_Network, 1);
+		Paths.compute(Requests, Option._thread_number, Option._path_table);
+		VONEGreedy::VONEGreedy Greedy;
+		Greedy.solve(Substrate_Network, Requests, TypeFlag, CoreNum, 0, &Paths);
+		_greedy_time = Greedy.get_solve_time();
+		const vector<vector<VONEGreedy::EdgeAssignment> >& Greedy_Assignment = Greedy.get_assignment();
+		vector<int> Slot_Number(Arc_Number);
+		_slot_horizon = 0;
+		for (int sd = 1; sd <= static_cast<int>(_edge.size()); sd++)
+		{
+			Slot_Number[2 * (sd - 1)] = _edge[sd - 1]._edge_bandwidth;
+			Slot_Number[2 * (sd - 1) + 1] = _edge[sd - 1]._edge_bandwidth;
+			_slot_horizon = max(_slot_horizon, _edge[sd - 1]._edge_bandwidth);
+		}
+		if (Greedy.get_blocked_number() == 0)
+		{
+			_slot_horizon = 1;
+			for (int r = 1; r <= Request_Number; r++)
+			{
+				Configuration Column;
+				Column._assignment = Greedy_Assignment[r - 1][0];
+				getCapacityRows(TypeFlag, CoreNum, 0, Column);
+				_slot_horizon = max(_slot_horizon, Column._end);
+			}
+		}
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			if (!Greedy_Assignment[r - 1].empty())
+			{
+				Configuration Column;
+				Column._request = r;
+				Column._assignment = Greedy_Assignment[r - 1][0];
+				getCapacityRows(TypeFlag, CoreNum, _slot_horizon, Column);
+				_column.push_back(Column);
+			}
+		}
+		_initial_column_number = static_cast<int>(_column.size());
+
+		//The identical requests of a class have the same paths and blocks, only their duals are different:
+		VONERequest::DemandClasses Classes;
+		Classes.assign(Requests);
+		int Class_Number = static_cast<int>(Classes.size());
+		vector<vector<int> > Class_Request(Class_Number);
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			Class_Request[Classes.get_class(r - 1)].push_back(r);
+		}
+		PricingGraph Graph;
+		getPricingGraph(Substrate_Network, Graph);
+		vector<int> Width_Position(Highest_Width + 1, -1);
+		vector<int> Width;
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			if (Width_Position[_bandwidth[r - 1]] < 0)
+			{
+				Width_Position[_bandwidth[r - 1]] = static_cast<int>(Width.size());
+				Width.push_back(_bandwidth[r - 1]);
+			}
+		}
+		_thread_number = max(min(Option._thread_number > 0 ? Option._thread_number : static_cast<int>(thread::hardware_concurrency()),
+			Class_Number), 1);
+
+		IloEnv env;
+		try
+		{
+			//The master: one configuration or the blocking of each request, the capacity of each slot and the highest index M.
+			//    A blocked request costs more than any configuration:
+			int Row_Number = Arc_Number * CoreNum * _slot_horizon;
+			IloNum Penalty = _slot_horizon + Graph._vertex_number;
+			IloModel Master(env);
+			IloObjective Objective = IloMinimize(env);
+			IloRangeArray Demand(env, Request_Number, 1, 1);
+			IloRangeArray Span(env, Request_Number, 0, IloInfinity);
+			IloRangeArray Capacity(env, Row_Number, -IloInfinity, 1);
+			Master.add(Objective);
+			Master.add(Demand);
+			Master.add(Span);
+			Master.add(Capacity);
+
+			IloNumColumn Max_Column = Objective(1);
+			for (int r = 1; r <= Request_Number; r++)
+			{
+				Max_Column += Span[r - 1](1);
+			}
+			IloNumVar Max_Index(Max_Column, Lowest_Index, IloInfinity);
+			Max_Column.end();
+			IloNumVarArray Blocked(env);
+			for (int r = 1; r <= Request_Number; r++)
+			{
+				Blocked.add(IloNumVar(Objective(Penalty) + Demand[r - 1](1), 0, 1));
+			}
+			IloNumVarArray Lambda(env);
+			for (vector<Configuration>::const_iterator ColumnIT = _column.begin(); ColumnIT != _column.end(); ColumnIT++)
+			{
+				IloNumColumn Column = Objective(ColumnIT->_hop_number) + Demand[ColumnIT->_request - 1](1) +
+					Span[ColumnIT->_request - 1](-ColumnIT->_end);
+				for (vector<int>::const_iterator RowIT = ColumnIT->_row.begin(); RowIT != ColumnIT->_row.end(); RowIT++)
+				{
+					Column += Capacity[*RowIT](1);
+				}
+				Lambda.add(IloNumVar(Column, 0, IloInfinity));
+				Column.end();
+			}
+
+			//The master is solved again from the last basis after the columns are added, so the log of the rounds is not printed:
+			IloCplex cplex(Master);
+			cplex.setOut(env.getNullStream());
+			cplex.setParam(IloCplex::Param::RootAlgorithm, IloCplex::Primal);
+			_lp_bound = -IloInfinity;
+			vector<double> Capacity_Price(Row_Number);
+			vector<double> Price_Sum(static_cast<size_t>(Arc_Number) * CoreNum * (_slot_horizon + 1));
+			vector<vector<double> > Block_Price(Width.size());
+			vector<vector<int> > Block_Core(Width.size());
+			vector<vector<int> > Block_Start(Width.size());
+			vector<double> Demand_Price(Request_Number);
+			vector<double> Span_Price(Request_Number);
+			vector<double> Reduced_Cost(Request_Number);
+			vector<Configuration> Candidate(Request_Number);
+			vector<char> Candidate_Flag(Request_Number);
+			for (int Round = 1; Round <= Option._column_round; Round++)
+			{
+				RoundStatistics Statistics;
+				chrono::steady_clock::time_point master_start = chrono::steady_clock::now();
+				if (!cplex.solve())
+				{
+					env.error() << "Failed to optimize the master LP of the column generation.\n";
+					throw(-1);
+				}
+				Statistics._lp_objective = cplex.getObjValue();
+				IloNumArray Dual(env);
+				cplex.getDuals(Dual, Demand);
+				for (int r = 1; r <= Request_Number; r++)
+				{
+					Demand_Price[r - 1] = Dual[r - 1];
+				}
+				cplex.getDuals(Dual, Span);
+				for (int r = 1; r <= Request_Number; r++)
+				{
+					Span_Price[r - 1] = max(static_cast<double>(Dual[r - 1]), 0.0);
+				}
+				cplex.getDuals(Dual, Capacity);
+				for (int Row = 0; Row < Row_Number; Row++)
+				{
+					Capacity_Price[Row] = max(-static_cast<double>(Dual[Row]), 0.0);
+				}
+				Dual.end();
+				Statistics._master_time = chrono::duration<double, milli>(chrono::steady_clock::now() - master_start).count();
+
+				//The prices of the blocks of each width of the requests:
+				chrono::steady_clock::time_point pricing_start = chrono::steady_clock::now();
+				for (int Row = 0; Row < Arc_Number * CoreNum; Row++)
+				{
+					Price_Sum[static_cast<size_t>(Row) * (_slot_horizon + 1)] = 0;
+					for (int t = 1; t <= _slot_horizon; t++)
+					{
+						Price_Sum[static_cast<size_t>(Row) * (_slot_horizon + 1) + t] = Price_Sum[static_cast<size_t>(Row) * (_slot_horizon + 1) + t - 1] +
+							Capacity_Price[Row * _slot_horizon + t - 1];
+					}
+				}
+				for (size_t w = 0; w < Width.size(); w++)
+				{
+					getBlockPrices(TypeFlag, CoreNum, Arc_Number, _slot_horizon, Width[w], Slot_Number, Price_Sum, Block_Price[w], Block_Core[w], Block_Start[w]);
+				}
+
+				//Each class is priced by the thread which takes it, and it only writes the candidates of its requests:
+				fill(Candidate_Flag.begin(), Candidate_Flag.end(), 0);
+				fill(Reduced_Cost.begin(), Reduced_Cost.end(), 0.0);
+				atomic<int> Next_Class(0);
+				//An exception of a worker is kept and thrown again by this thread after the join, the other workers stop taking classes:
+				vector<exception_ptr> Worker_Error(_thread_number);
+				vector<thread> Workers;
+				for (int t = 0; t < _thread_number; t++)
+				{
+					Workers.push_back(thread([&, t]()
+					{
+						try
+						{
+							vector<double> Cost;
+							vector<int> Last_Arc;
+							vector<double> Path_Cost;
+							for (int k = Next_Class++; k < Class_Number; k = Next_Class++)
+							{
+								int First = Class_Request[k][0];
+								int Source = Substrate_Network.find_vertex(Requests.get_source(First - 1));
+								int Destination = Substrate_Network.find_vertex(Requests.get_destination(First - 1));
+								const VONEPath::PathList& Shortest_Path = Paths.get_paths(Requests.get_source(First - 1),
+									Requests.get_destination(First - 1));
+								int Bandwidth = _bandwidth[First - 1];
+								if ((Source < 0) || (Destination < 0) || Shortest_Path.empty() || (Bandwidth > _slot_horizon))
+								{
+									continue;
+								}
+								int Hop_Limit = Option._hop_slack < 0 ? Graph._vertex_number - 1 :
+									min(static_cast<int>(Shortest_Path[0]._link.size()) + Option._hop_slack, Graph._vertex_number - 1);
+
+								//The path of the least cost for each end index m = s + Bandwidth - 1:
+								int w = Width_Position[Bandwidth];
+								int Start_Number = _slot_horizon - Bandwidth + 1;
+								Path_Cost.assign(Start_Number, 0);
+								for (int s = 1; s <= Start_Number; s++)
+								{
+									Path_Cost[s - 1] = getShortestPath(Graph, Source, Destination, Hop_Limit, &Block_Price[w][(s - 1) * Arc_Number],
+										Cost, Last_Arc, 0);
+								}
+
+								for (vector<int>::const_iterator RequestIT = Class_Request[k].begin(); RequestIT != Class_Request[k].end(); RequestIT++)
+								{
+									int r = *RequestIT;
+									int Best_Start = 0;
+									double Best_Cost = numeric_limits<double>::infinity();
+									for (int s = 1; s <= Start_Number; s++)
+									{
+										double Request_Cost = Path_Cost[s - 1] + Span_Price[r - 1] * (s + Bandwidth - 1);
+										if (Request_Cost < Best_Cost)
+										{
+											Best_Cost = Request_Cost;
+											Best_Start = s;
+										}
+									}
+									if ((Best_Start == 0) || (Best_Cost - Demand_Price[r - 1] > -1e-6))
+									{
+										Reduced_Cost[r - 1] = Best_Start == 0 ? 0 : min(Best_Cost - Demand_Price[r - 1], 0.0);
+										continue;
+									}
+
+									//The configuration of the path and blocks, whose end index may be lower than m:
+									Configuration& Column = Candidate[r - 1];
+									Column._request = r;
+									Column._assignment = VONEGreedy::EdgeAssignment();
+									Column._assignment._bandwidth = Bandwidth;
+									VONEPath::Path Route;
+									getShortestPath(Graph, Source, Destination, Hop_Limit, &Block_Price[w][(Best_Start - 1) * Arc_Number], Cost,
+										Last_Arc, &Route);
+									for (size_t i = 0; i < Route._link.size(); i++)
+									{
+										int Arc = 2 * (Route._link[i] - 1) + Route._direction[i];
+										VONEGreedy::LinkAssignment Hop;
+										Hop._link = Route._link[i];
+										Hop._direction = Route._direction[i];
+										Hop._core = Block_Core[w][(Best_Start - 1) * Arc_Number + Arc];
+										Hop._start = Block_Start[w][(Best_Start - 1) * Arc_Number + Arc];
+										Column._assignment._hop.push_back(Hop);
+									}
+									for (int slot = Best_Start; (TypeFlag == 0) && (slot <= Best_Start + Bandwidth - 1); slot++)
+									{
+										Column._assignment._slot.push_back(slot);
+									}
+									getCapacityRows(TypeFlag, CoreNum, _slot_horizon, Column);
+
+									double Column_Cost = Column._hop_number + Span_Price[r - 1] * Column._end - Demand_Price[r - 1];
+									for (vector<int>::const_iterator RowIT = Column._row.begin(); RowIT != Column._row.end(); RowIT++)
+									{
+										Column_Cost += Capacity_Price[*RowIT];
+									}
+									Reduced_Cost[r - 1] = Best_Cost - Demand_Price[r - 1];
+									Candidate_Flag[r - 1] = Column_Cost < -1e-6;
+								}
+							}
+						}
+						catch (...)
+						{
+							Worker_Error[t] = current_exception();
+							Next_Class = Class_Number;
+						}
+					}));
+				}
+				for (vector<thread>::iterator WorkerIT = Workers.begin(); WorkerIT != Workers.end(); WorkerIT++)
+				{
+					WorkerIT->join();
+				}
+				for (int t = 0; t < _thread_number; t++)
+				{
+					if (Worker_Error[t])
+					{
+						rethrow_exception(Worker_Error[t]);
+					}
+				}
+
+				//Each request takes one configuration at most, so the LP objective plus the negative reduced costs is a bound:
+				Statistics._lagrangian_bound = Statistics._lp_objective;
+				for (int r = 1; r <= Request_Number; r++)
+				{
+					Statistics._lagrangian_bound += min(Reduced_Cost[r - 1], 0.0);
+				}
+				_lp_bound = max(_lp_bound, Statistics._lagrangian_bound);
+
+				//The candidates are added in the order of the requests, so the master is the same for any number of threads:
+				Statistics._added_column_number = 0;
+				for (int r = 1; r <= Request_Number; r++)
+				{
+					if (!Candidate_Flag[r - 1])
+					{
+						continue;
+					}
+					const Configuration& Added = Candidate[r - 1];
+					IloNumColumn Column = Objective(Added._hop_number) + Demand[r - 1](1) + Span[r - 1](-Added._end);
+					for (vector<int>::const_iterator RowIT = Added._row.begin(); RowIT != Added._row.end(); RowIT++)
+					{
+						Column += Capacity[*RowIT](1);
+					}
+					Lambda.add(IloNumVar(Column, 0, IloInfinity));
+					Column.end();
+					_column.push_back(Added);
+					Statistics._added_column_number++;
+				}
+				Statistics._pricing_time = chrono::duration<double, milli>(chrono::steady_clock::now() - pricing_start).count();
+				_round.push_back(Statistics);
+				cout << "Round " << Round << ": LP Objective = " << Statistics._lp_objective << ", Lagrangian "
+					<< (TypeFlag == 0 ? "Estimate = " : "Bound = ") << Statistics._lagrangian_bound << ", Columns Added = " << Statistics._added_column_number << ", Pricing Time = "
+					<< Statistics._pricing_time << "ms, Master Time = " << Statistics._master_time << "ms" << endl;
+				if (Statistics._added_column_number == 0)
+				{
+					break;
+				}
+			}
+
+			//The integer phase over the generated columns starts from the greedy solution:
+			chrono::steady_clock::time_point integer_start = chrono::steady_clock::now();
+			Master.add(IloConversion(env, Lambda, ILOBOOL));
+			Master.add(IloConversion(env, Blocked, ILOBOOL));
+			cplex.setOut(env.out());
+			IloNumVarArray Start_Variables(env);
+			IloNumArray Start_Values(env);
+			for (int i = 0; i < _initial_column_number; i++)
+			{
+				Start_Variables.add(Lambda[i]);
+				Start_Values.add(1);
+			}
+			for (int r = 1; r <= Request_Number; r++)
+			{
+				Start_Variables.add(Blocked[r - 1]);
+				Start_Values.add(Greedy_Assignment[r - 1].empty() ? 1 : 0);
+			}
+			cplex.addMIPStart(Start_Variables, Start_Values, IloCplex::MIPStartAuto, "Greedy");
+			Start_Variables.end();
+			Start_Values.end();
+			if (!cplex.solve())
+			{
+				env.error() << "Failed to optimize the integer phase of the column generation.\n";
+				throw(-1);
+			}
+			_integer_objective = cplex.getObjValue();
+			_integer_bound = cplex.getBestObjValue();
+			IloNumArray Lambda_Value(env);
+			cplex.getValues(Lambda_Value, Lambda);
+			for (IloInt i = 0; i < Lambda.getSize(); i++)
+			{
+				if (Lambda_Value[i] > 0.5)
+				{
+					_assignment[_column[i]._request - 1].assign(1, _column[i]._assignment);
+				}
+			}
+			Lambda_Value.end();
+			_integer_time = chrono::duration<double, milli>(chrono::steady_clock::now() - integer_start).count();
+		}
+		catch (IloException& e)
+		{
+			cerr << "Concert exception caught: " << e << endl;
+		}
+		catch (...)
+		{
+			cerr << "Unknown exception caught!\n";
+		}
+		env.end();
+
+		//The objective of the ILP over all requests, the spectrum end index of an unused link is Omega - 1:
+		_blocked_number = 0;
+		_hop_number = 0;
+		_max_index = Lowest_Index;
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			_blocked_number += _assignment[r - 1].empty() ? 1 : 0;
+			for (vector<VONEGreedy::EdgeAssignment>::const_iterator EdgeIT = _assignment[r - 1].begin(); EdgeIT != _assignment[r - 1].end(); EdgeIT++)
+			{
+				Configuration Column;
+				Column._assignment = *EdgeIT;
+				getCapacityRows(TypeFlag, CoreNum, 0, Column);
+				_hop_number += Column._hop_number;
+				_max_index = max(_max_index, Column._end);
+			}
+		}
+		_solve_time = chrono::duration<double, milli>(chrono::steady_clock::now() - solve_start).count();
+	}
+
+	ostream& operator <<(ostream& outs, const VONEColumn& Column)
+	{
+		int Request_Number = static_cast<int>(Column._assignment.size());
+		double Pricing_Time = 0, Master_Time = 0;
+		for (vector<RoundStatistics>::const_iterator RoundIT = Column._round.begin(); RoundIT != Column._round.end(); RoundIT++)
+		{
+			Pricing_Time += RoundIT->_pricing_time;
+			Master_Time += RoundIT->_master_time;
+		}
+		outs << "Column Generation Rounds = " << Column._round.size() << ", Initial Columns = " << Column._initial_column_number
+			<< ", Generated Columns = " << Column._column.size() - Column._initial_column_number << ", Slot Horizon = "
+			<< Column._slot_horizon << ", Pricing Threads = " << Column._thread_number << endl;
+		for (size_t i = 1; i <= Column._round.size(); i++)
+		{
+			const RoundStatistics& Statistics = Column._round[i - 1];
+			outs << "Round " << i << ": LP Objective = " << Statistics._lp_objective << ", Lagrangian "
+				<< (Column._type_flag == 0 ? "Estimate = " : "Bound = ") << Statistics._lagrangian_bound << ", Columns Added = " << Statistics._added_column_number << ", Pricing Time = "
+				<< Statistics._pricing_time << "ms, Master Time = " << Statistics._master_time << "ms" << endl;
+		}
+		//The TDM pricing only builds one block of time slots on all links, so its bound is a heuristic estimate and not a bound
+		//    of the ILP, and there is no bound without a round:
+		if (!Column._round.empty())
+		{
+			outs << (Column._type_flag == 0 ? "LP Estimate (heuristic for TDM) = " : "LP Bound = ") << Column._lp_bound << ", ";
+		}
+		outs << "Integer Objective = " << Column._integer_objective << ", Integer Bound = " << Column._integer_bound << endl;
+		outs << "Greedy Time = " << Column._greedy_time << "ms, Pricing Time = " << Pricing_Time << "ms, Master Time = " << Master_Time
+			<< "ms, Integer Time = " << Column._integer_time << "ms" << endl;
+		outs << "Blocked Requests = " << Column._blocked_number << " of " << Request_Number << endl;
+		outs << "Solution Objective Value Maximum M = " << Column._max_index + Column._hop_number << endl;
+		outs << "Solving Time = " << Column._solve_time << "ms" << endl;
+		outs << "Solution Variables Value are following:\n";
+		outs << left << setw(30) << "Variable Name" << "Value" << endl;
+
+		VONEGreedy::print_assignment(outs, Column._edge, Column._bandwidth, Column._assignment, Column._type_flag);
+		outs << "Ms = " << Column._max_index << endl;
+		return outs;
+	}
+
+	VONEColumn::~VONEColumn()
+	{
+
+	}
+}
+
+namespace
+{
+	void getPricingGraph(const VONETopo::Topo& Substrate_Network, PricingGraph& Graph)
+	{
+		VONETopo::NodeList Vertexes;
+		VONETopo::LinkList Links;
+		Substrate_Network.get_vertex(Vertexes);
+		Substrate_Network.get_edge(Links);
+		Graph._vertex_number = static_cast<int>(Vertexes.size());
+		Graph._vertex_id.assign(Graph._vertex_number, 0);
+		for (int v = 0; v < Graph._vertex_number; v++)
+		{
+			Graph._vertex_id[v] = Vertexes[v]._vertex_id;
+		}
+
+		int Arc_Number = 2 * static_cast<int>(Links.size());
+		Graph._tail.assign(Arc_Number, 0);
+		Graph._head.assign(Arc_Number, 0);
+		Graph._out_offset.assign(Graph._vertex_number + 1, 0);
+		for (int sd = 1; sd <= static_cast<int>(Links.size()); sd++)
+		{
+			int Source = Substrate_Network.find_vertex(Links[sd - 1]._edge_source._vertex_id);
+			int Destination = Substrate_Network.find_vertex(Links[sd - 1]._edge_destination._vertex_id);
+			Graph._tail[2 * (sd - 1)] = Source;
+			Graph._head[2 * (sd - 1)] = Destination;
+			Graph._tail[2 * (sd - 1) + 1] = Destination;
+			Graph._head[2 * (sd - 1) + 1] = Source;
+			Graph._out_offset[Source + 1]++;
+			Graph._out_offset[Destination + 1]++;
+		}
+		for (int v = 1; v <= Graph._vertex_number; v++)
+		{
+			Graph._out_offset[v] += Graph._out_offset[v - 1];
+		}
+		Graph._out_arc.assign(Arc_Number, 0);
+		vector<int> Position(Graph._out_offset.begin(), Graph._out_offset.end() - 1);
+		for (int Arc = 0; Arc < Arc_Number; Arc++)
+		{
+			Graph._out_arc[Position[Graph._tail[Arc]]++] = Arc;
+		}
+	}
+
+	void getCapacityRows(const int TypeFlag, const int C, const int Slot_Horizon, VONEColumn::Configuration& Column)
+	{
+		const VONEGreedy::EdgeAssignment& Edge = Column._assignment;
+		Column._hop_number = static_cast<int>(Edge._hop.size());
+		Column._end = 0;
+		Column._row.clear();
+		for (vector<VONEGreedy::LinkAssignment>::const_iterator HopIT = Edge._hop.begin(); HopIT != Edge._hop.end(); HopIT++)
+		{
+			int Row = ((2 * (HopIT->_link - 1) + HopIT->_direction) * C + HopIT->_core - 1) * Slot_Horizon;
+			if (TypeFlag != 0)
+			{
+				Column._end = max(Column._end, HopIT->_start + Edge._bandwidth - 1);
+				for (int slot = HopIT->_start; (Slot_Horizon > 0) && (slot <= HopIT->_start + Edge._bandwidth - 1); slot++)
+				{
+					Column._row.push_back(Row + slot - 1);
+				}
+				continue;
+			}
+			Column._end = Edge._slot.empty() ? Column._end : max(Column._end, Edge._slot.back());
+			for (vector<int>::const_iterator SlotIT = Edge._slot.begin(); (Slot_Horizon > 0) && (SlotIT != Edge._slot.end()); SlotIT++)
+			{
+				Column._row.push_back(Row + *SlotIT - 1);
+			}
+		}
+	}
+
+	void getBlockPrices(const int TypeFlag, const int C, const int Arc_Number, const int Slot_Horizon, const int Width,
+		const vector<int>& Slot_Number, const vector<double>& Price_Sum, vector<double>& Block_Price, vector<int>& Block_Core,
+		vector<int>& Block_Start)
+	{
+		int Start_Number = max(Slot_Horizon - Width + 1, 0);
+		Block_Price.assign(static_cast<size_t>(Start_Number) * Arc_Number, 0);
+		Block_Core.assign(static_cast<size_t>(Start_Number) * Arc_Number, 1);
+		Block_Start.assign(static_cast<size_t>(Start_Number) * Arc_Number, 1);
+		for (int s = 1; s <= Start_Number; s++)
+		{
+			for (int Arc = 0; Arc < Arc_Number; Arc++)
+			{
+				size_t Block = static_cast<size_t>(s - 1) * Arc_Number + Arc;
+				Block_Price[Block] = numeric_limits<double>::infinity();
+				for (int c = 1; (c <= C) && (s + Width - 1 <= Slot_Number[Arc]); c++)
+				{
+					size_t Sum = (static_cast<size_t>(Arc) * C + c - 1) * (Slot_Horizon + 1);
+					double Price = Price_Sum[Sum + s + Width - 1] - Price_Sum[Sum + s - 1];
+					if (Price < Block_Price[Block])
+					{
+						Block_Price[Block] = Price;
+						Block_Core[Block] = c;
+						Block_Start[Block] = s;
+					}
+				}
+
+				//A link of WDM or OFDM takes the block of the least price ending at m at most, the lowest one for the same price:
+				if ((TypeFlag != 0) && (s > 1) && (Block_Price[Block - Arc_Number] <= Block_Price[Block]))
+				{
+					Block_Price[Block] = Block_Price[Block - Arc_Number];
+					Block_Core[Block] = Block_Core[Block - Arc_Number];
+					Block_Start[Block] = Block_Start[Block - Arc_Number];
+				}
+			}
+		}
+	}
+
+	double getShortestPath(const PricingGraph& Graph, const int Source, const int Destination, const int Hop_Limit,
+		const double* Block_Price, vector<double>& Cost, vector<int>& Last_Arc, VONEPath::Path* Route)
+	{
+		//Cost[h * N + v] is the least cost of h hops from Source to the vertex v:
+		int N = Graph._vertex_number;
+		Cost.assign(static_cast<size_t>(Hop_Limit + 1) * N, numeric_limits<double>::infinity());
+		Last_Arc.assign(static_cast<size_t>(Hop_Limit + 1) * N, -1);
+		Cost[Source] = 0;
+		double Best_Cost = numeric_limits<double>::infinity();
+		int Best_Hop = 0;
+		for (int h = 1; h <= Hop_Limit; h++)
+		{
+			for (int v = 0; v < N; v++)
+			{
+				double Tail_Cost = Cost[static_cast<size_t>(h - 1) * N + v];
+				if (Tail_Cost == numeric_limits<double>::infinity())
+				{
+					continue;
+				}
+				for (int i = Graph._out_offset[v]; i < Graph._out_offset[v + 1]; i++)
+				{
+					int Arc = Graph._out_arc[i];
+					size_t Label = static_cast<size_t>(h) * N + Graph._head[Arc];
+					if (Tail_Cost + 1 + Block_Price[Arc] < Cost[Label])
+					{
+						Cost[Label] = Tail_Cost + 1 + Block_Price[Arc];
+						Last_Arc[Label] = Arc;
+					}
+				}
+			}
+			if (Cost[static_cast<size_t>(h) * N + Destination] < Best_Cost)
+			{
+				Best_Cost = Cost[static_cast<size_t>(h) * N + Destination];
+				Best_Hop = h;
+			}
+		}
+
+		if ((Route != 0) && (Best_Hop > 0))
+		{
+			Route->_vertex.assign(Best_Hop + 1, 0);
+			Route->_link.assign(Best_Hop, 0);
+			Route->_direction.assign(Best_Hop, 0);
+			int v = Destination;
+			for (int h = Best_Hop; h >= 1; h--)
+			{
+				int Arc = Last_Arc[static_cast<size_t>(h) * N + v];
+				Route->_vertex[h] = Graph._vertex_id[v];
+				Route->_link[h - 1] = Arc / 2 + 1;
+				Route->_direction[h - 1] = Arc % 2;
+				v = Graph._tail[Arc];
+			}
+			Route->_vertex[0] = Graph._vertex_id[v];
+		}
+
+		return Best_Cost;
+	}
+}
+#endif
@@ -0,0 +1,92 @@
+//This file declares class VONEColumn
+//------------------------------------------------
+//File Name: Column.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include "ILP.h"
+
+namespace VONEColumn
+{
+	//A configuration of a request: the path, the core and spectrum (or time slots) of each link are those of _assignment, _end is
+	//    its highest index and _row holds its capacity rows of the master
+	struct Configuration
+	{
+		int _request;
+		int _end;
+		int _hop_number;
+		VONEGreedy::EdgeAssignment _assignment;
+		vector<int> _row;
+	};
+
+	//The statistics of a round of the column generation, the times are the wall times in ms
+	struct RoundStatistics
+	{
+		double _lp_objective;
+		double _lagrangian_bound;
+		int _added_column_number;
+		double _pricing_time;
+		double _master_time;
+	};
+
+	//Solve the RSCA problem by column generation over the configurations of the requests. The restricted master LP selects one
+	//    configuration of each request (or blocks it at a penalty), each slot of each core of each link in each direction is used
+	//    by one configuration at most, and M is at least the highest index of the selected configurations, so the objective is
+	//    M plus the total hops as the ILP. It starts from the greedy solution, whose highest index is the slot horizon of the
+	//    capacity rows, since a solution with a higher index is worse than the greedy one. The pricing is a shortest path with
+	//    a hop limit over the links of the substrate network, the cost of a link is the least dual price of a free block on one
+	//    of its cores. For WDM and OFDM each link takes its own block at most at the end index, so the pricing is exact and the
+	//    Lagrangian bound is a lower bound of the ILP; for TDM the time slots of the new configurations are one block on all
+	//    links, so the bound is the one of these configurations and it is printed as an estimate. The identical requests of a
+	//    demand class share their shortest paths, which are priced by _thread_number threads. The final integer phase selects the
+	//    configurations among the generated columns by CPLEX
+	class VONEColumn
+	{
+	public:
+		VONEColumn();
+
+		void solve(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests, int TypeFlag, int CoreNum,
+			const VONEILP::ILPOption& Option);
+		//Precondition: Topology of substrate netwrok and the requests have been assigned, TypeFlag has been assigned, CoreNum
+		//    has been given and every request is one virtual edge
+		//Postcondition: The master LP is solved again after each round of pricing until no column of negative reduced cost is
+		//    found or Option._column_round rounds, the links of a new column are at most Option._hop_slack hops more than the
+		//    shortest path (any for a negative slack), and the integer phase gives the solution. The requests without a
+		//    configuration in it are blocked
+
+		friend ostream& operator <<(ostream& outs, const VONEColumn& Column);
+		//Precondition: outs has been connected to an out stream
+		//Postcondition: Print the statistics of the rounds, the bounds and the solution in the same form of the ILP to outs
+
+		~VONEColumn();
+
+	private:
+		int _type_flag;
+		int _core_number;
+		VONETopo::LinkList _edge;
+		vector<int> _bandwidth;
+
+		//The columns of the master, the first _initial_column_number are the greedy solution:
+		vector<Configuration> _column;
+		int _initial_column_number;
+		int _slot_horizon;
+		int _thread_number;
+		vector<RoundStatistics> _round;
+
+		vector<vector<VONEGreedy::EdgeAssignment> > _assignment;
+		int _blocked_number;
+		int _hop_number;
+		int _max_index;
+
+		//The bounds and the wall times in ms:
+		double _lp_bound;
+		double _integer_objective;
+		double _integer_bound;
+		double _greedy_time;
+		double _integer_time;
+		double _solve_time;
+	};
+}
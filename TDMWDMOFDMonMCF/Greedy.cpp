@@ -0,0 +1,297 @@
+//This file defines class VONEGreedy
+//------------------------------------------------
+//File Name: Greedy.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#include "Greedy.h"
+#include "Variable.h"
+
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+
+namespace VONEGreedy
+{
+	void print_assignment(ostream& outs, const VONETopo::LinkList& Substrate_Network_Edge, const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<vector<EdgeAssignment> >& Assignment, const int TypeFlag)
+	{
+		int Request_Number = static_cast<int>(Assignment.size());
+
+		//The variables are named as those of the ILP:
+		vector<int> Virtual_Networks_Edge_Number(Request_Number);
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			Virtual_Networks_Edge_Number[r - 1] = static_cast<int>(Assignment[r - 1].size());
+		}
+		VONEILP::VariableTable Table;
+		Table.assign(Substrate_Network_Edge, Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth, TypeFlag, 1);
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			for (size_t e = 1; e <= Assignment[r - 1].size(); e++)
+			{
+				const EdgeAssignment& Edge = Assignment[r - 1][e - 1];
+				for (vector<LinkAssignment>::const_iterator HopIT = Edge._hop.begin(); HopIT != Edge._hop.end(); HopIT++)
+				{
+					outs << left << setw(30) << Table.add(VONEILP::VariableKey('x', r, static_cast<int>(e), 0, HopIT->_link,
+						HopIT->_direction)) << 1 << endl;
+					outs << left << setw(30) << Table.add(VONEILP::VariableKey('X', r, HopIT->_core, 0, HopIT->_link,
+						HopIT->_direction)) << 1 << endl;
+					if (TypeFlag != 0)
+					{
+						outs << left << setw(30) << Table.add(VONEILP::VariableKey('f', r, static_cast<int>(e), 0, HopIT->_link,
+							HopIT->_direction)) << HopIT->_start << endl;
+						continue;
+					}
+					for (size_t slot = 1; slot <= Edge._slot.size(); slot++)
+					{
+						outs << left << setw(30) << Table.add(VONEILP::VariableKey('t', r, static_cast<int>(slot), static_cast<int>(e),
+							HopIT->_link, HopIT->_direction)) << Edge._slot[slot - 1] << endl;
+					}
+				}
+			}
+		}
+	}
+
+	bool assign_spectrum(VONESpectrum::SpectrumOccupancy& Occupancy, const int CoreNum, const VONEPath::Path& Edge_Path, 
+		const int Bandwidth, AssignmentBuffer& Buffer, EdgeAssignment& Assignment)
+	{
+		for (size_t i = 0; i < Edge_Path._link.size(); i++)
+		{
+			LinkAssignment Hop;
+			Hop._link = Edge_Path._link[i];
+			Hop._direction = Edge_Path._direction[i];
+			Hop._core = 0;
+			Hop._start = 0;
+
+			//The lowest start index of a free block over all cores, the lower core is selected for the same start index:
+			for (int c = 1; c <= CoreNum; c++)
+			{
+				int Start = Occupancy.first_fit(Hop._link, Hop._direction, c, Bandwidth, Buffer._free, Buffer._run);
+				if ((Start != 0) && ((Hop._start == 0) || (Start < Hop._start)))
+				{
+					Hop._core = c;
+					Hop._start = Start;
+				}
+			}
+
+			if (Hop._start == 0)
+			{
+				return false;
+			}
+			Occupancy.allocate(Hop._link, Hop._direction, Hop._core, Hop._start, Bandwidth);
+			Assignment._hop.push_back(Hop);
+		}
+
+		return true;
+	}
+
+	bool assign_time_slot(VONESpectrum::SpectrumOccupancy& Occupancy, const int CoreNum, const VONEPath::Path& Edge_Path, 
+		const int Bandwidth, AssignmentBuffer& Buffer, EdgeAssignment& Assignment)
+	{
+		//The time slots of a virtual edge are the same on all its links, and a link uses only one core for them,
+		//    so the cores which are still able to carry all selected time slots are recorded for each link,
+		//    the core c of the hop i is a candidate if Candidate_Core[i * CoreNum + c - 1] is 1:
+		size_t Hop_Number = Edge_Path._link.size();
+		vector<char>& Candidate_Core = Buffer._candidate_core;
+		Candidate_Core.assign(Hop_Number * CoreNum, 1);
+		int Last_Slot = Hop_Number == 0 ? Bandwidth : Occupancy.get_slot_number(Edge_Path._link[0]);
+		for (size_t i = 1; i < Hop_Number; i++)
+		{
+			Last_Slot = min(Last_Slot, Occupancy.get_slot_number(Edge_Path._link[i]));
+		}
+
+		for (int slot = 1; (slot <= Last_Slot) && (static_cast<int>(Assignment._slot.size()) < Bandwidth); slot++)
+		{
+			bool Free = true;
+			for (size_t i = 0; (i < Hop_Number) && Free; i++)
+			{
+				bool Free_Core = false;
+				for (int c = 1; (c <= CoreNum) && !Free_Core; c++)
+				{
+					Free_Core = Candidate_Core[i * CoreNum + c - 1] && Occupancy.is_free(Edge_Path._link[i], Edge_Path._direction[i], c, slot, 1);
+				}
+				Free = Free_Core;
+			}
+			if (!Free)
+			{
+				continue;
+			}
+
+			Assignment._slot.push_back(slot);
+			for (size_t i = 0; i < Hop_Number; i++)
+			{
+				for (int c = 1; c <= CoreNum; c++)
+				{
+					Candidate_Core[i * CoreNum + c - 1] = Candidate_Core[i * CoreNum + c - 1] && 
+						Occupancy.is_free(Edge_Path._link[i], Edge_Path._direction[i], c, slot, 1);
+				}
+			}
+		}
+
+		if (static_cast<int>(Assignment._slot.size()) < Bandwidth)
+		{
+			return false;
+		}
+		for (size_t i = 0; i < Hop_Number; i++)
+		{
+			LinkAssignment Hop;
+			Hop._link = Edge_Path._link[i];
+			Hop._direction = Edge_Path._direction[i];
+			Hop._core = static_cast<int>(find(Candidate_Core.begin() + i * CoreNum, Candidate_Core.begin() + (i + 1) * CoreNum, 1) - 
+				(Candidate_Core.begin() + i * CoreNum) + 1);
+			Hop._start = Assignment._slot[0];
+			for (vector<int>::const_iterator SlotIT = Assignment._slot.begin(); SlotIT != Assignment._slot.end(); SlotIT++)
+			{
+				Occupancy.allocate(Hop._link, Hop._direction, Hop._core, *SlotIT, 1);
+			}
+			Assignment._hop.push_back(Hop);
+		}
+
+		return true;
+	}
+
+	void release_assignment(VONESpectrum::SpectrumOccupancy& Occupancy, const EdgeAssignment& Assignment, const int TypeFlag)
+	{
+		for (vector<LinkAssignment>::const_iterator HopIT = Assignment._hop.begin(); HopIT != Assignment._hop.end(); HopIT++)
+		{
+			if (TypeFlag != 0)
+			{
+				Occupancy.release(HopIT->_link, HopIT->_direction, HopIT->_core, HopIT->_start, Assignment._bandwidth);
+			}
+			for (vector<int>::const_iterator SlotIT = Assignment._slot.begin(); (TypeFlag == 0) && (SlotIT != Assignment._slot.end()); SlotIT++)
+			{
+				Occupancy.release(HopIT->_link, HopIT->_direction, HopIT->_core, *SlotIT, 1);
+			}
+		}
+	}
+
+	VONEGreedy::VONEGreedy() :_type_flag(0), _core_number(0), _blocked_number(0), _hop_number(0), _max_index(0), _solve_time(0)
+	{
+
+	}
+
+	void VONEGreedy::solve(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests,
+		int TypeFlag, int CoreNum, const VONESpectrum::SpectrumOccupancy* Occupied, const VONEPath::PathCache* Paths)
+	{
+		chrono::steady_clock::time_point solve_start = chrono::steady_clock::now();
+		_type_flag = TypeFlag;
+		_core_number = CoreNum;
+		Substrate_Network.get_edge(_edge);
+
+		if (Occupied != 0)
+		{
+			_occupancy = *Occupied;
+		}
+		else
+		{
+			_occupancy.assign(_edge, CoreNum);
+		}
+
+		//The shortest paths of the vertex pairs are computed once if they are not given:
+		VONEPath::PathCache Shortest_Paths(Substrate_Network, 1);
+		if (Paths == 0)
+		{
+			Shortest_Paths.compute(Requests, 1);
+			Paths = &Shortest_Paths;
+		}
+		int Request_Number = static_cast<int>(Requests.size());
+		_assignment.assign(Request_Number, vector<EdgeAssignment>());
+		_embedded.assign(Request_Number, false);
+		_bandwidth.assign(Request_Number, 0);
+		_blocked_number = 0;
+		_hop_number = 0;
+		_max_index = 0;
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			//The spectrum end index of an unused link is Omega - 1 in the ILP:
+			_bandwidth[r - 1] = Requests.get_width(r - 1);
+			if (TypeFlag != 0)
+			{
+				_max_index = max(_max_index, _bandwidth[r - 1] - 1);
+			}
+
+			//A request is one virtual edge between the substrate vertexes of its source and destination:
+			const VONEPath::PathList& Shortest_Path = Paths->get_paths(Requests.get_source(r - 1), Requests.get_destination(r - 1));
+
+			EdgeAssignment Assignment;
+			Assignment._bandwidth = _bandwidth[r - 1];
+			bool Embedded = !Shortest_Path.empty() && ((TypeFlag == 0) ?
+				assign_time_slot(_occupancy, CoreNum, Shortest_Path[0], _bandwidth[r - 1], _buffer, Assignment) :
+				assign_spectrum(_occupancy, CoreNum, Shortest_Path[0], _bandwidth[r - 1], _buffer, Assignment));
+			//The links occupied before a failure are kept in Assignment to be released:
+			_assignment[r - 1].push_back(Assignment);
+
+			if (!Embedded)
+			{
+				//Release the resources of the virtual edges of the request which have been embedded:
+				for (vector<EdgeAssignment>::const_iterator EdgeIT = _assignment[r - 1].begin(); EdgeIT != _assignment[r - 1].end(); EdgeIT++)
+				{
+					release_assignment(_occupancy, *EdgeIT, TypeFlag);
+				}
+				_assignment[r - 1].clear();
+				_blocked_number++;
+				continue;
+			}
+
+			_embedded[r - 1] = true;
+			for (vector<EdgeAssignment>::const_iterator EdgeIT = _assignment[r - 1].begin(); EdgeIT != _assignment[r - 1].end(); EdgeIT++)
+			{
+				_hop_number += static_cast<int>(EdgeIT->_hop.size());
+				for (vector<LinkAssignment>::const_iterator HopIT = EdgeIT->_hop.begin(); HopIT != EdgeIT->_hop.end(); HopIT++)
+				{
+					if (TypeFlag != 0)
+					{
+						_max_index = max(_max_index, HopIT->_start + EdgeIT->_bandwidth - 1);
+					}
+					else if (!EdgeIT->_slot.empty())
+					{
+						_max_index = max(_max_index, EdgeIT->_slot.back());
+					}
+				}
+			}
+		}
+		_solve_time = chrono::duration<double, milli>(chrono::steady_clock::now() - solve_start).count();
+	}
+
+	const vector<vector<EdgeAssignment> >& VONEGreedy::get_assignment() const
+	{
+		return _assignment;
+	}
+
+	int VONEGreedy::get_blocked_number() const
+	{
+		return _blocked_number;
+	}
+
+	int VONEGreedy::get_objective() const
+	{
+		return _max_index + _hop_number;
+	}
+
+	double VONEGreedy::get_solve_time() const
+	{
+		return _solve_time;
+	}
+
+	ostream& operator <<(ostream& outs, const VONEGreedy& Greedy)
+	{
+		int Request_Number = static_cast<int>(Greedy._assignment.size());
+		outs << "Blocked Requests = " << Greedy._blocked_number << " of " << Request_Number << endl;
+		outs << "Solution Objective Value Maximum M = " << Greedy.get_objective() << endl;
+		outs << "Solving Time = " << Greedy._solve_time << "ms" << endl;
+		outs << "Solution Variables Value are following:\n";
+		outs << left << setw(30) << "Variable Name" << "Value" << endl;
+
+		print_assignment(outs, Greedy._edge, Greedy._bandwidth, Greedy._assignment, Greedy._type_flag);
+		outs << "Ms = " << Greedy._max_index << endl;
+		return outs;
+	}
+
+	VONEGreedy::~VONEGreedy()
+	{
+
+	}
+}
@@ -0,0 +1,113 @@
+//This file declares class VONEGreedy
+//------------------------------------------------
+//File Name: Greedy.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include "Topo.h"
+#include "Request.h"
+#include "Path.h"
+#include "Spectrum.h"
+
+namespace VONEGreedy
+{
+	//The resources of a virtual edge on a link of its path. _start is the start index of WDM or OFDM,
+	//    the time slots of TDM are the same on all links and kept by the virtual edge
+	struct LinkAssignment
+	{
+		int _link;
+		int _direction;
+		int _core;
+		int _start;
+	};
+
+	//The path and resources of a virtual edge of _bandwidth slots, _slot is empty for WDM or OFDM
+	struct EdgeAssignment
+	{
+		int _bandwidth;
+		vector<LinkAssignment> _hop;
+		vector<int> _slot;
+	};
+
+	//The buffers reused by the assignments of the virtual edges, so an assignment does not allocate memory once they have grown
+	struct AssignmentBuffer
+	{
+		vector<VONESpectrum::SlotWord> _free;
+		vector<VONESpectrum::SlotWord> _run;
+		vector<char> _candidate_core;
+	};
+
+	bool assign_spectrum(VONESpectrum::SpectrumOccupancy& Occupancy, const int CoreNum, const VONEPath::Path& Edge_Path, 
+		const int Bandwidth, AssignmentBuffer& Buffer, EdgeAssignment& Assignment);
+	//Precondition: Occupancy holds the occupation of the links over CoreNum cores
+	//Postcondition: Return false if a link of Edge_Path has no free block of Bandwidth slots on any core, otherwise each
+	//    link gets the core and the lowest start index of a free block, which are occupied. The links occupied before a 
+	//    failure are kept in Assignment to be released
+
+	bool assign_time_slot(VONESpectrum::SpectrumOccupancy& Occupancy, const int CoreNum, const VONEPath::Path& Edge_Path, 
+		const int Bandwidth, AssignmentBuffer& Buffer, EdgeAssignment& Assignment);
+	//Precondition: Occupancy holds the occupation of the links over CoreNum cores
+	//Postcondition: Return false if Bandwidth time slots can not be found, otherwise the lowest time slots which are free on
+	//    one core of every link of Edge_Path are assigned, and they are occupied on these cores
+
+	void release_assignment(VONESpectrum::SpectrumOccupancy& Occupancy, const EdgeAssignment& Assignment, const int TypeFlag);
+	//Precondition: The slots of Assignment are occupied in Occupancy
+	//Postcondition: The slots of Assignment are free
+
+	void print_assignment(ostream& outs, const VONETopo::LinkList& Substrate_Network_Edge, const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<vector<EdgeAssignment> >& Assignment, const int TypeFlag);
+	//Precondition: outs has been connected to an out stream, and Assignment holds the assignments of the virtual edges of each request
+	//Postcondition: Print the link, core and start index (or time slot) variables of Assignment with the names of the ILP to outs
+
+	//Embed the requests one by one without a solver: each virtual edge is routed on a shortest path, and the core and the
+	//    spectrum (or time slots) of each link are assigned by first-fit under the same rules as the ILP
+	class VONEGreedy
+	{
+	public:
+		VONEGreedy();
+
+		void solve(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests, int TypeFlag, int CoreNum,
+			const VONESpectrum::SpectrumOccupancy* Occupied = 0, const VONEPath::PathCache* Paths = 0);
+		//Precondition: Topology of substrate netwrok and the requests have been assigned,
+		//    TypeFlag has been assigned and CoreNum has been given
+		//Postcondition: The requests of Requests are embedded in their order for TypeFlag service over CoreNum cores,
+		//    the requests which can not be embedded are blocked. The slots of Occupied are taken by earlier requests if it is given.
+		//    The shortest paths are the first paths of Paths if it is given, which must hold the vertex pairs of Requests
+
+		const vector<vector<EdgeAssignment> >& get_assignment() const;
+		//Postcondition: Return the assignments of the virtual edges of each request, which are empty for a blocked request
+
+		int get_blocked_number() const;
+		//Postcondition: Return the number of the blocked requests
+
+		int get_objective() const;
+		//Postcondition: Return the objective of the ILP for the embedded requests, the maximum index plus the total hops
+
+		double get_solve_time() const;
+		//Postcondition: Return the wall time of the last solve in ms
+
+		friend ostream& operator <<(ostream& outs, const VONEGreedy& Greedy);
+		//Precondition: outs has been connected to an out stream
+		//Postcondition: Print the solution in the same form of the ILP to outs
+
+		~VONEGreedy();
+
+	private:
+		int _type_flag;
+		int _core_number;
+		VONETopo::LinkList _edge;
+		vector<int> _bandwidth;
+		VONESpectrum::SpectrumOccupancy _occupancy;
+		AssignmentBuffer _buffer;
+
+		vector<vector<EdgeAssignment> > _assignment;
+		vector<bool> _embedded;
+		int _blocked_number;
+		int _hop_number;
+		int _max_index;
+		double _solve_time;
+	};
+}
@@ -6,44 +6,59 @@
 //Last Modified: Jun. 30th 2021
 //------------------------------------------------
 
+//The ILP is not built when CPLEX is not installed, see the greedy engine in Greedy.h:
+#ifndef VONE_NO_CPLEX
 #include "ILP.h"
+#include "Path.h"
 
 #include <numeric>
 #include <string>
 #include <iomanip>
+#include <sstream>
 #include <algorithm>
+#include <queue>
+#include <set>
+#include <thread>
+#include <exception>
+#include <chrono>
+#include <climits>
 
 namespace
 {
 	void getILPVertexInputParameter
 	(const VONETopo::Topo& Substrate_Network,
-		const vector<VONETopo::Topo>& Virtual_Network_List,
+		const VONERequest::RequestTable& Requests,
 		int& Request_Number,
 		int& Substrate_Network_Vertex_Number,
 		vector<int>& Virtual_Networks_Vertex_Number,
 		vector<int>& Accumulate_Virtual_Networks_Vertex_Number,
 		vector<vector<int> >& Computing_Capacity_in_Virtual_Vertexes);
-	//Precondition: The topology Substrate_Network and topology vector Virtual_Network_List have been assigned, and other
+	//Precondition: The topology Substrate_Network and the table Requests have been assigned, and other
 	//    parameters have been defined.
-	//Postcondition: The information from the topologys will be assigned to Request_Number, Substrate_Network_Vertex_Number, 
+	//Postcondition: The information from them will be assigned to Request_Number, Substrate_Network_Vertex_Number, 
 	//    Virtual_Networks_Vertex_Number, Accumulate_Virtual_Networks_Vertex_Number and Computing_Capacity_in_Virtual_Vertexes.
 
+	//The constraints of the arc-flow formulation are built for the requests from Start_Request, and the ones of two requests for 
+	//    the pairs with at least one request from Start_Request, so the new requests can be added to a built model.
+
 	void constraints1
 	(IloBoolVarArray x,
 		IloRangeArray c,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Vertex_Number,
-		const vector<int> Virtual_Networks_Vertex_Number,
-		const vector<int> Accumulate_Virtual_Networks_Vertex_Number,
-		const vector<vector<int> > Computing_Capacity_in_Virtual_Vertexes);
+		const vector<int>& Virtual_Networks_Vertex_Number,
+		const vector<vector<int> >& Computing_Capacity_in_Virtual_Vertexes,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter has been excuted, so Request_Number, Substrate_Network_Vertex_Number,
-	//    Virtual_Networks_Vertex_Number Accumulate_Virtual_Networks_Vertex_Number, Computing_Capacity_in_Virtual_Vertexes were assigned.
+	//    Virtual_Networks_Vertex_Number and Computing_Capacity_in_Virtual_Vertexes were assigned.
 	//Postcondition: The constraint of that assigning request source and destination has been added into constraint c. 
 	//    And new variables of x will be added.
 
 	void getILPEdgeInputParameter
 	(const VONETopo::Topo& Substrate_Network,
-		const vector<VONETopo::Topo>& Virtual_Network_List,
+		const VONERequest::RequestTable& Requests,
 		VONETopo::LinkList& Substrate_Network_Edge,
 		int& Substrate_Network_Edge_Number,
 		int& Min_Substrate_Network_Bandwidth,
@@ -53,41 +68,61 @@ namespace
 		vector<int>& Virtual_Networks_Bandwidth,
 		vector<int>& Accumulate_Virtual_Networks_Bandwidth,
 		vector<int>& Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth);
-	//Precondition: The topology Substrate_Network and topology vector Virtual_Network_List have been assigned, and other
+	//Precondition: The topology Substrate_Network and the table Requests have been assigned, and other
 	//    parameters have been defined.
-	//Postcondition: The information from the topologys will be assigned to Substrate_Network_Edge, Substrate_Network_Edge_Number, 
+	//Postcondition: The information from them will be assigned to Substrate_Network_Edge, Substrate_Network_Edge_Number, 
 	//    Virtual_Networks_Edge, Virtual_Networks_Edge_Number, Accumulate_Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth 
 	//    and Accumulate_Virtual_Networks_Bandwidth.
 
+	void getHopDistance
+	(const vector<vector<int> >& Adjacent_Vertexes,
+		const int Source,
+		vector<int>& Hop_Distance);
+	//Precondition: Adjacent_Vertexes[s - 1] lists the neighbours of the substrate vertex s.
+	//Postcondition: Hop_Distance[s - 1] is the hop number of the shortest path from Source to s, or -1 if s can not be reached.
+
+	void getCandidateLinks
+	(const VONETopo::LinkList& Substrate_Network_Edge,
+		const int Substrate_Network_Vertex_Number,
+		const vector<VONETopo::LinkList>& Virtual_Networks_Edge,
+		const vector<vector<int> >& Computing_Capacity_in_Virtual_Vertexes,
+		const int Hop_Slack,
+		vector<vector<bool> >& Candidate_Links);
+	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Substrate_Network_Edge,
+	//    Substrate_Network_Vertex_Number, Virtual_Networks_Edge and Computing_Capacity_in_Virtual_Vertexes were assigned.
+	//Postcondition: Candidate_Links[r - 1][sd - 1] tells whether the link sd lies on a path of the request r which is at most 
+	//    Hop_Slack hops longer than its shortest path. All links are candidates when Hop_Slack is negative.
+
 	void constraints2
 	(IloBoolVarArray x,
 		IloRangeArray c,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const VONETopo::LinkList& Substrate_Network_Edge);
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<vector<bool> >& Candidate_Links,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Accumulate_Virtual_Networks_Edge_Number and Substrate_Network_Edge
-	//    were assigned. 
+	//    Substrate_Network_Edge_Number and Virtual_Networks_Edge_Number were assigned. The function getCandidateLinks has been
+	//    excuted, so Candidate_Links was assigned.
 	//Postcondition: The constraint of that the link from s to d and d to s should be disjoint has been added to the constraint c.
-	//    And new variables of x will be added.
+	//    And new variables of x will be added, the variables of the links which are not candidates of the request are fixed to 0.
 
 	void constraints3
 	(IloRangeArray c,
 		const IloBoolVarArray x,
 		const IloBoolVarArray y,
 		const int Request_Number,
-		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
+		const int Start_Request,
+		const vector<int>& Virtual_Networks_Edge_Number,
 		const int Substrate_Network_Vertex_Number,
-		const vector<int> Accumulate_Virtual_Networks_Vertex_Number,
-		const VONETopo::LinkList& Substrate_Network_Edge,
-		const vector<VONETopo::LinkList>& Virtual_Networks_Edge);
+		const VONETopo::Topo& Substrate_Network,
+		const vector<VONETopo::LinkList>& Virtual_Networks_Edge,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Accumulate_Virtual_Networks_Edge_Number, Substrate_Network_Vertex_Number, 
-	//    Accumulate_Virtual_Networks_Vertex_Number, Substrate_Network_Edge and Virtual_Networks_Edge were assigned. 
+	//    Virtual_Networks_Edge_Number, Substrate_Network_Vertex_Number and Virtual_Networks_Edge were assigned, and Substrate_Network
+	//    has been finalized.
 	//    X and y must be added into the constraint c.
 	//Postcondition: The constraint of that the flow conservation of each request when it is embedded into the substrate has been 
 	//    added to the constraint c.
@@ -97,14 +132,14 @@ namespace
 		IloRangeArray con,
 		const IloBoolVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const VONETopo::LinkList& Substrate_Network_Edge,
-		const int C);
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const int C,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Accumulate_Virtual_Networks_Edge_Number, 
-	//    Substrate_Network_Edge and C were assigned. And y must be added into the constraint con.
+	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number and C were assigned. And y must be added into the constraint con.
 	//Postcondition: The constraint of that only one core can be selected when the link is determined has been added to the 
 	//    constraint con. And new variables of x will be added. 
 
@@ -113,14 +148,16 @@ namespace
 		IloModel mod,
 		const IloBoolVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
 		const VONETopo::LinkList& Substrate_Network_Edge,
-		const vector<int> Virtual_Networks_Bandwidth);
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-    //    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Accumulate_Virtual_Networks_Edge_Number, 
-    //    Substrate_Network_Edge and Virtual_Networks_Bandwidth were assigned. And y must be added into the problem model mod.
+    //    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Substrate_Network_Edge and Virtual_Networks_Bandwidth
+    //    were assigned. And y must be added into the problem model mod.
     //Postcondition: The constraint of wavelength start index or frequency slot start has been added to the 
     //    problem model mod. And new variables of x will be added. 
 
@@ -129,15 +166,16 @@ namespace
 		IloModel mod,
 		const IloBoolVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
 		const VONETopo::LinkList& Substrate_Network_Edge,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth);
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-    //    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Accumulate_Virtual_Networks_Edge_Number, 
-    //    Substrate_Network_Edge, Virtual_Networks_Bandwidth and Accumulate_Virtual_Networks_Bandwidth were assigned. 
+    //    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Substrate_Network_Edge and Virtual_Networks_Bandwidth
+    //    were assigned.
 	//    And y must be added into the problem model mod.
     //Postcondition: The constraint of time slot start index has been added to the problem model mod. And new variables of x will be added. 
 
@@ -146,145 +184,849 @@ namespace
 		IloRangeArray con,
 		const IloIntVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const VONETopo::LinkList& Substrate_Network_Edge,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth);
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Accumulate_Virtual_Networks_Edge_Number, 
-	//    Substrate_Network_Edge and Virtual_Networks_Bandwidth were assigned. 
+	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number and Virtual_Networks_Bandwidth were assigned. 
 	//    And y must be added into the constraint con.
 	//Postcondition: The constraint of wavelength end index or frequency slot end index named spectrum continuity has been added to the constraint con. 
 	//    And new variables of x will be added.
 
+	//The constraints are generated as the following native rows by worker threads, and only the calling thread turns them into 
+	//    the Concert objects because an IloEnv can not be shared by threads.
+
+	//The logical no overlap of two requests on a core of a link in one direction: if both requests use the core and their start
+	//    indexes (or time slots) are not 0, one of them ends before the other starts
+	struct IfThenNoOverlap
+	{
+		int _core_r1;
+		int _core_r2;
+		int _index_r1;
+		int _index_r2;
+		int _omega_r1;
+		int _omega_r2;
+	};
+
+	//The logical no overlap of a request with the slots from _first to _last occupied before the model on a core of a link in one
+	//    direction: if the request uses the core and its start index (or time slot) is not 0, it ends before _first or starts after _last
+	struct IfThenOccupied
+	{
+		int _core;
+		int _index;
+		int _first;
+		int _last;
+		int _omega;
+	};
+
+	//The linearized no overlap of two requests on a core of a link in one direction with the order variable _order, _link_r1 and 
+	//    _link_r2 are -1 if the request has only one virtual edge
+	struct BigMNoOverlap
+	{
+		int _order;
+		int _core_r1;
+		int _core_r2;
+		int _link_r1;
+		int _link_r2;
+		int _index_r1;
+		int _index_r2;
+		int _m_order;
+		int _m_core;
+		int _omega_r1;
+		int _omega_r2;
+	};
+
+	//The keys of the order variables and the rows referring to them by their positions in _order_key
+	struct BigMNoOverlapBuffer
+	{
+		vector<VONEILP::VariableKey> _order_key;
+		vector<BigMNoOverlap> _row;
+	};
+
+	//The time slot consistency of a virtual edge on two links: if both links are used, the time slots are the same
+	struct IfThenConsistency
+	{
+		int _link_1;
+		int _link_2;
+		int _index_1;
+		int _index_2;
+	};
+
+	void getNoOverlapRows8
+	(const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index,
+		vector<IfThenNoOverlap>& Rows);
+	//Precondition: The same as constraints8, and r1 < r2 are two requests and sd is a link of the substrate network.
+	//Postcondition: The rows of the spectrum no overlap for WDM or OFDM between r1 and r2 on the link sd have been appended to Rows.
+
+	void getNoOverlapRows9
+	(const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index,
+		vector<IfThenNoOverlap>& Rows);
+	//Precondition: The same as constraints9, and r1 < r2 are two requests and sd is a link of the substrate network.
+	//Postcondition: The rows of the time slot no overlap for TDM between r1 and r2 on the link sd have been appended to Rows.
+
+	void getConsistencyRows11
+	(const int r,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const VONEILP::VarIndex& Index,
+		vector<IfThenConsistency>& Rows);
+	//Precondition: The same as constraints11, and r is a request.
+	//Postcondition: The rows of the time slot consistency for TDM of the request r have been appended to Rows.
+
+	void getNoOverlapRows16
+	(const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index,
+		BigMNoOverlapBuffer& Rows);
+	//Precondition: The same as constraints16, and r1 < r2 are two requests and sd is a link of the substrate network.
+	//Postcondition: The order variables and the rows of the linearized spectrum no overlap for WDM or OFDM between r1 and r2 on 
+	//    the link sd have been appended to Rows.
+
+	void getNoOverlapRows17
+	(const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index,
+		BigMNoOverlapBuffer& Rows);
+	//Precondition: The same as constraints17, and r1 < r2 are two requests and sd is a link of the substrate network.
+	//Postcondition: The order variables and the rows of the linearized time slot no overlap for TDM between r1 and r2 on the link sd
+	//    have been appended to Rows.
+
+	int addIfThenNoOverlap(IloModel mod, const IloBoolVarArray x, const IloIntVarArray y, const vector<IfThenNoOverlap>& Rows);
+	//Precondition: X and y are the core and start index (or time slot) variables which Rows refer to.
+	//Postcondition: The rows have been added to the problem model mod in their order, and the number of them is returned.
+
+	int addIfThenConsistency(IloModel mod, const IloIntVarArray x, const IloBoolVarArray y, const vector<IfThenConsistency>& Rows);
+	//Precondition: X and y are the time slot and link variables which Rows refer to.
+	//Postcondition: The rows have been added to the problem model mod in their order, and the number of them is returned.
+
+	int addBigMNoOverlap
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloBoolVarArray l,
+		const IloIntVarArray z,
+		const BigMNoOverlapBuffer& Rows,
+		VONEILP::VariableTable& Table);
+	//Precondition: Y, l and z are the core, link and start index (or time slot) variables which Rows refer to.
+	//Postcondition: The order variables of Rows have been added to x and the rows have been added to the constraint con in their 
+	//    order, and the number of the rows is returned.
+
+	void getRequestChunks(const vector<long long>& Request_Work, const int Thread_Number, vector<pair<int, int> >& Chunks);
+	//Precondition: Request_Work[r - 1] is the estimated number of the constraints generated for the request r.
+	//Postcondition: Chunks holds the consecutive requests [first, last] covering all requests in order, each chunk has about 
+	//    the same work, and there are enough chunks to keep Thread_Number threads busy with a bounded buffer.
+
+	template <class Buffer, class Generator, class Materializer>
+	void buildRowsInParallel(const vector<pair<int, int> >& Chunks, const int Thread_Number, Generator Generate, Materializer Materialize);
+	//Precondition: Generate(first, last, Buffer&) appends the native rows of the requests from first to last and is thread-safe, 
+	//    Materialize(const Buffer&) adds the native rows to the model.
+	//Postcondition: The rows of all chunks have been generated by Thread_Number threads and materialized by the calling thread 
+	//    in the order of Chunks, so the model is the same as the one built by one thread. An exception thrown by Generate on a worker
+	//    thread is thrown again by the calling thread after the workers have been joined.
+
+	int addNoOverlap8
+	(IloModel mod,
+		const IloBoolVarArray x,
+		const IloIntVarArray y,
+		const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The same as constraints8, and r1 < r2 are two requests and sd is a link of the substrate network.
+	//Postcondition: The constraint of spectrum no overlap for WDM or OFDM between r1 and r2 on the link sd has been added to the 
+	//    problem model mod, and the number of the added constraints is returned.
+
 	void constraints8
 	(IloModel mod,
 		const IloBoolVarArray x,
 		const IloIntVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const int C);
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int Thread_Number,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Accumulate_Virtual_Networks_Edge_Number, 
-	//    Virtual_Networks_Bandwidth and C were assigned. X and y must be added into the problem model mod.
-	//Postcondition: The constraint of spectrum no overlap for WDM or OFDM has been added to the problem model mod.
+	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth, C and Candidate_Links were
+	//    assigned. X and y must be added into the problem model mod.
+	//Postcondition: The constraint of spectrum no overlap for WDM or OFDM has been added to the problem model mod only on the links
+	//    which are candidates of both requests. The constraints are generated by Thread_Number threads and added in the order of r1.
 	
+	int addNoOverlap9
+	(IloModel mod,
+		const IloBoolVarArray x,
+		const IloIntVarArray y,
+		const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The same as constraints9, and r1 < r2 are two requests and sd is a link of the substrate network.
+	//Postcondition: The constraint of time slot no overlap for TDM between r1 and r2 on the link sd has been added to the 
+	//    problem model mod, and the number of the added constraints is returned.
+
 	void constraints9
 	(IloModel mod,
 		const IloBoolVarArray x,
 		const IloIntVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth,
-		const int C);
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int Thread_Number,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-    //    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth, Accumulate_Virtual_Networks_Bandwidth
-	//    and C were assigned. X and y must be added into the problem mopdel mod.
-    //Postcondition: The constraint of spectrum no overlap for TDM has been added to the problem model mod.
+    //    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth, C and Candidate_Links were
+	//    assigned. X and y must be added into the problem mopdel mod.
+    //Postcondition: The constraint of spectrum no overlap for TDM has been added to the problem model mod only on the links
+	//    which are candidates of both requests. The constraints are generated by Thread_Number threads and added in the order of r1.
 
-	void constraints10
-	(IloModel mod,
-		const IloIntVarArray x,
-		const IloBoolVarArray y,
+	long long constraints10
+	(IloIntVarArray x,
+		IloRangeArray con,
+		const IloIntVarArray y,
+		const IloBoolVarArray z,
+		const int TypeFlag,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number);
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<vector<bool> >& Candidate_Links,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-    //    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number and Accumulate_Virtual_Networks_Edge_Number
-    //    were assigned. X and y must be added into the problem mopdel mod.
-    //Postcondition: The constraint of spectrum consistency for WDM or OFDM has been added to the problem model mod.
+	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth and Candidate_Links were assigned.
+	//    Y is the start index (TypeFlag is 1 or 2) or time slot (TypeFlag is 0) variables and z is the link variables.
+	//Postcondition: The global offset variables g_r_e (or g_r_slot_e for TDM) of each virtual edge have been appended to x, and the
+	//    constraint of spectrum (or time slot) consistency has been added to the constraint con: the index on each used candidate 
+	//    link equals the offset, by two linear rows for each link in each direction. For TDM the time slot order maintain is kept on
+	//    the offsets. The number of the rows grows linearly in the links, and it is returned.
 
-	void constraints11
+	long long constraints11
 	(IloModel mod,
 		const IloIntVarArray x,
 		const IloBoolVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth);
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int Thread_Number,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Accumulate_Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth 
-	//    and Accumulate_Virtual_Networks_Bandwidth were assigned. X and y must be added into the problem mopdel mod.
-	//Postcondition: The constraint of spectrum consistency for TDM has been added to the problem model mod.
+	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number and Virtual_Networks_Bandwidth were assigned. X and y must be
+	//    added into the problem mopdel mod.
+	//Postcondition: The constraint of spectrum consistency for TDM has been added to the problem model mod, one logical constraint 
+	//    for each two links in each two directions. The constraints of the requests are generated by Thread_Number threads and added
+	//    in the order of the requests, and the number of them is returned.
 
-	void constraints12
+	long long constraints12
 	(IloModel mod,
 		const IloIntVarArray x,
 		const IloBoolVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth);
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const VONEILP::VarIndex& Index);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-    //    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Accumulate_Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth 
-    //    and Accumulate_Virtual_Networks_Bandwidth were assigned. X and y must be added into the problem mopdel mod.
-    //Postcondition: The constraint of time slot order maintain for TDM has been added to the problem model mod.
+    //    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number and Virtual_Networks_Bandwidth were assigned. X and y must be
+    //    added into the problem mopdel mod.
+    //Postcondition: The constraint of time slot order maintain for TDM has been added to the problem model mod, and the number of 
+	//    the constraints is returned.
 
 	void constraints13
 	(IloIntVarArray x,
 		IloRangeArray con,
 		const int Request_Number,
-		const int Min_Substrate_Network_Bandwidth,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Bandwidth);
+		const int Start_Request,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table);
 	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
-    //    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number and Accumulate_Virtual_Networks_Edge_Number were assigned.
-    //Postcondition: The constraint of time slot start index for TDM has been added to the constraint con. 
-	//    And new variables of x will be added. This constraint is another method to make sure the spectrum consistency.
+	//    Substrate_Network_Edge and Virtual_Networks_Bandwidth were assigned. Each request has only one virtual edge.
+	//Postcondition: The time slot variables t_r_slot of the compact formulation for TDM have been appended to x, so the time slot 
+	//    slot of the request r is x[(slot - 1) + Accumulate_Virtual_Networks_Bandwidth[r - 1]], and the time slot order of each 
+	//    request has been added to the constraint con. The time slots belong to the request instead of its links, which is another
+	//    method to make sure the time slot consistency.
 
 	void constraints14
-	(IloModel mod,
+	(IloRangeArray con,
 		const IloIntVarArray x,
 		const IloBoolVarArray y,
 		const int Request_Number,
-		const int Substrate_Network_Vertex_Number,
-		const vector<int> Virtual_Networks_Vertex_Number,
-		const vector<int> Accumulate_Virtual_Networks_Vertex_Number,
-		const vector<vector<int> > Computing_Capacity_in_Virtual_Vertexes,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Bandwidth);
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const vector<vector<bool> >& Candidate_Links,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The function constraints13 has been excuted, so x holds the time slot variables. Y is the link variables.
+	//Postcondition: The constraint of the time slot capacity of the compact formulation for TDM has been added to the constraint con:
+	//    the last time slot of a request is at most the bandwidth of each link it uses. Only the candidate links whose bandwidth is
+	//    less than the largest one need it.
+
+	void getNoOverlapRows15
+	(const int r1,
+		const int r2,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int M,
+		const int NoOverlap_Flag,
+		const VONEILP::VarIndex& Index,
+		vector<IfThenNoOverlap>& Logical_Rows,
+		BigMNoOverlapBuffer& BigM_Rows);
+	//Precondition: The same as constraints15, r1 < r2 are two requests and M is the largest bandwidth of the substrate network.
+	//Postcondition: The rows of the time slot no overlap of the compact formulation between r1 and r2 on their shared candidate
+	//    links have been appended to Logical_Rows (NoOverlap_Flag is 0), or the order variables and the rows have been appended 
+	//    to BigM_Rows (NoOverlap_Flag is 1).
 
 	void constraints15
+	(IloBoolVarArray x,
+		IloModel mod,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloIntVarArray z,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int NoOverlap_Flag,
+		const int Thread_Number,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The function constraints13 has been excuted, so z holds the time slot variables. Y is the core variables.
+	//Postcondition: The constraint of the time slot no overlap of the compact formulation for TDM has been added on the links which
+	//    are candidates of both requests, to the problem model mod as logical constraints (NoOverlap_Flag is 0), or to the constraint
+	//    con as linearized constraints with the order variables appended to x (NoOverlap_Flag is 1). One order variable of a slot
+	//    pair of two requests is shared by all links and cores, because the time slots belong to the requests. The constraints are 
+	//    generated by Thread_Number threads and added in the order of r1.
+
+	int getSlotPosition
+	(const int r,
+		const int slot,
+		const int e,
+		const int sd,
+		const int Direction,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int Slot_Flag,
+		const VONEILP::VarIndex& Index);
+	//Postcondition: Return the position of the time slot slot of the virtual edge e of the request r on the link sd in the direction
+	//    Direction among the time slot variables, which is t_r_slot_e_s_d of the link (Slot_Flag is 0) or t_r_slot of the request
+	//    in the compact formulation (Slot_Flag is 1).
+
+	int addNoOverlap16
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloBoolVarArray l,
+		const IloIntVarArray z,
+		const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The same as constraints16, and r1 < r2 are two requests and sd is a link of the substrate network.
+	//Postcondition: The linearized spectrum no overlap for WDM or OFDM between r1 and r2 on the link sd has been added to the 
+	//    constraint con with new order variables of x, and the number of the added constraints is returned.
+
+	void constraints16
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloBoolVarArray l,
+		const IloIntVarArray z,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int Thread_Number,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
+	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Substrate_Network_Edge, Virtual_Networks_Bandwidth, C and
+	//    Candidate_Links were assigned. Y, l and z are the core, link and 
+	//    start index variables which must be added into the constraint con.
+	//Postcondition: The linearized spectrum no overlap for WDM or OFDM has been added to the constraint con. One order variable 
+	//    of x is added for each request pair on each link which is a candidate of both requests, and the big-M of the link is 
+	//    derived from its bandwidth. The constraints are generated by Thread_Number threads and added in the order of r1.
+
+	int addNoOverlap17
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloBoolVarArray l,
+		const IloIntVarArray z,
+		const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The same as constraints17, and r1 < r2 are two requests and sd is a link of the substrate network.
+	//Postcondition: The linearized time slot no overlap for TDM between r1 and r2 on the link sd has been added to the 
+	//    constraint con with new order variables of x, and the number of the added constraints is returned.
+
+	void constraints17
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloBoolVarArray l,
+		const IloIntVarArray z,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int Thread_Number,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Request_Number, 
+	//    Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number, Substrate_Network_Edge, Virtual_Networks_Bandwidth, C and
+	//    Candidate_Links were assigned. Y, l and z are the 
+	//    core, link and time slot variables which must be added into the constraint con.
+	//Postcondition: The linearized time slot no overlap for TDM has been added to the constraint con. One order variable of x is
+	//    added for each slot pair of each request pair on each link which is a candidate of both requests, and the big-M of the link
+	//    is derived from its bandwidth. The constraints are generated by Thread_Number threads and added in the order of r1.
+
+	void getCandidatePaths
+	(const VONEPath::PathCache& Paths,
+		const vector<VONETopo::LinkList>& Virtual_Networks_Edge,
+		const vector<vector<int> >& Computing_Capacity_in_Virtual_Vertexes,
+		vector<VONEPath::PathList>& Candidate_Paths,
+		vector<int>& Accumulate_Candidate_Path_Number);
+	//Precondition: The function getILPVertexInputParameter and getILPEdgeInputParameter have been excuted, so Virtual_Networks_Edge
+	//    and Computing_Capacity_in_Virtual_Vertexes were assigned. Each request has only one virtual edge, and the paths of its
+	//    vertex pair have been computed in Paths.
+	//Postcondition: Candidate_Paths[r - 1] holds the K shortest paths of the request r in the substrate network, and 
+	//    Accumulate_Candidate_Path_Number[r - 1] is the number of candidate paths of the requests before r.
+
+	//The candidate path _k1 of the request _r1 and the candidate path _k2 of the request _r2 > _r1 which pass at least one link in
+	//    the same direction
+	struct PathPair
+	{
+		int _r1;
+		int _r2;
+		int _k1;
+		int _k2;
+	};
+
+	bool less_path_pair(const PathPair& FirstPathPair, const PathPair& SecondPathPair);
+	//Postcondition: Return true if FirstPathPair is before SecondPathPair in the order of r1, r2, k1 and then k2
+
+	void getSharedPathPairs
+	(const vector<VONEPath::PathList>& Candidate_Paths,
+		const int Substrate_Network_Edge_Number,
+		vector<PathPair>& Path_Pairs);
+	//Precondition: The function getCandidatePaths has been excuted, so Candidate_Paths was assigned.
+	//Postcondition: Path_Pairs holds each two candidate paths of two requests which pass a link in the same direction once, in the
+	//    order of less_path_pair. The pairs are found from the list of the candidate paths on each link in each direction, so only
+	//    the paths sharing a link are visited.
+
+	void constraints18
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const int Request_Number,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		VONEILP::VariableTable& Table);
+	//Precondition: The function getCandidatePaths has been excuted, so Candidate_Paths and Accumulate_Candidate_Path_Number were assigned.
+	//Postcondition: The constraint of that each request selects one of its candidate paths has been added to the constraint con.
+	//    And new variables of x will be added.
+
+	void constraints19
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const int Request_Number,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const int C,
+		VONEILP::VariableTable& Table);
+	//Precondition: The function getCandidatePaths has been excuted, so Candidate_Paths and Accumulate_Candidate_Path_Number were 
+	//    assigned, and C was given. Y must be added into the constraint con.
+	//Postcondition: The constraint of that only one core can be selected on the selected path has been added to the constraint con.
+	//    And new variables of x will be added.
+
+	void constraints20
+	(IloIntVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const int Request_Number,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table);
+	//Precondition: The function getCandidatePaths has been excuted, so Candidate_Paths and Accumulate_Candidate_Path_Number were 
+	//    assigned, and Substrate_Network_Edge and Virtual_Networks_Bandwidth were assigned. Y must be added into the constraint con.
+	//Postcondition: The constraint of the wavelength or frequency slot start index of each request in the bandwidth of its 
+	//    selected path has been added to the constraint con. And new variables of x will be added.
+
+	void constraints21
+	(IloIntVarArray x,
+		IloRangeArray con,
+		const IloIntVarArray y,
+		const int Request_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table);
+	//Precondition: Virtual_Networks_Bandwidth was assigned, and y must be added into the constraint con.
+	//Postcondition: The constraint of the wavelength or frequency slot end index of each request has been added to the constraint con.
+	//    And new variables of x will be added.
+
+	void constraints22
+	(IloIntVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const int Request_Number,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table);
+	//Precondition: The function getCandidatePaths has been excuted, so Candidate_Paths and Accumulate_Candidate_Path_Number were 
+	//    assigned, and Substrate_Network_Edge, Virtual_Networks_Bandwidth and Accumulate_Virtual_Networks_Bandwidth were assigned. 
+	//    Y must be added into the constraint con.
+	//Postcondition: The constraint of the ordered time slots of each request in the bandwidth of its selected path has been added to
+	//    the constraint con. And new variables of x will be added.
+
+	void constraints23
+	(IloBoolVarArray x,
+		IloModel mod,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloIntVarArray z,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const int NoOverlap_Flag,
+		VONEILP::VariableTable& Table);
+	//Precondition: The function getCandidatePaths has been excuted, so Candidate_Paths and Accumulate_Candidate_Path_Number were 
+	//    assigned, and Substrate_Network_Edge, Virtual_Networks_Bandwidth, C and NoOverlap_Flag were given. Y and z are the core
+	//    and start index variables of the path formulation.
+	//Postcondition: The constraint of spectrum no overlap for WDM or OFDM between every two candidate paths sharing a link in the same 
+	//    direction, found by getSharedPathPairs, has been added to the problem model mod (NoOverlap_Flag is 0) or to the constraint
+	//    con with new order variables of x (NoOverlap_Flag is 1).
+
+	void constraints24
+	(IloBoolVarArray x,
+		IloModel mod,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloIntVarArray z,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int C,
+		const int NoOverlap_Flag,
+		VONEILP::VariableTable& Table);
+	//Precondition: The function getCandidatePaths has been excuted, so Candidate_Paths and Accumulate_Candidate_Path_Number were 
+	//    assigned, and Substrate_Network_Edge, Virtual_Networks_Bandwidth, Accumulate_Virtual_Networks_Bandwidth, C and NoOverlap_Flag 
+	//    were given. Y and z are the core and time slot variables of the path formulation.
+	//Postcondition: The constraint of time slot no overlap for TDM between every two candidate paths sharing a link in the same 
+	//    direction, found by getSharedPathPairs, has been added to the problem model mod (NoOverlap_Flag is 0) or to the constraint
+	//    con with new order variables of x (NoOverlap_Flag is 1).
+
+	void constraints25
 	(IloModel mod,
 		const IloBoolVarArray x,
 		const IloIntVarArray y,
+		const int TypeFlag,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const VONESpectrum::SpectrumOccupancy& Occupied,
+		const int Slot_Flag,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The same as constraints8 (TypeFlag is 1 or 2) or constraints9 (TypeFlag is 0), and Occupied holds the slots taken
+	//    by the requests embedded before this model on the same substrate network with C cores. Slot_Flag is the same as 
+	//    getSlotPosition.
+	//Postcondition: The constraint of no overlap with the occupied slots of Occupied has been added to the problem model mod on the 
+	//    candidate links of each request, one constraint for each run of the occupied slots of a core.
+
+	long long constraints26
+	(IloRangeArray con,
+		const IloBoolVarArray x,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The function constraints4 has been excuted, so x holds the core variables X_r_c_s_d. No slot of the cores is
+	//    occupied before the model, so the C cores of a link in a direction are interchangeable.
+	//Postcondition: The core symmetry breaking has been added to the constraint con: a request uses the core c > 1 of a link in 
+	//    a direction only if the core c - 1 is used by the request or an earlier one there. Relabelling the cores of each link in 
+	//    each direction in the order of their first request turns any solution into one satisfying it with the same objective, so 
+	//    the optimum is kept. Only the candidate requests of a link are in the rows, and the number of the rows is returned.
+
+	long long constraints27
+	(IloRangeArray con,
+		const IloBoolVarArray x,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONERequest::DemandClasses& Classes,
+		const VONEILP::VarIndex& Index);
+	//Precondition: The function constraints2 has been excuted, so x holds the link variables. Classes holds the classes of the
+	//    identical requests of the model.
+	//Postcondition: The request ordering inside each class of the identical requests has been added to the constraint con: the 
+	//    weighted arcs sum_{s, d} (2 * (sd - 1) + d + 1) * x_r_e_s_d of a request is at least the one of the previous request of 
+	//    its class. Swapping two identical requests keeps a solution and its objective, so the optimum is kept and the permutations
+	//    of a class are pruned. The number of the rows is returned.
+
+	long long constraints28
+	(IloRangeArray con,
+		const IloBoolVarArray x,
+		const int Request_Number,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const VONERequest::DemandClasses& Classes);
+	//Precondition: The function constraints18 has been excuted, so x holds the path variables. Classes is the same as constraints27,
+	//    so the identical requests have the same candidate paths.
+	//Postcondition: The request ordering inside each class of the identical requests of the path formulation has been added to 
+	//    the constraint con: the selected path of a request is not before the one of the previous request of its class. The number
+	//    of the rows is returned.
+
+	void getClassOrder
+	(const vector<vector<VONEGreedy::EdgeAssignment> >& Assignment,
+		const VONERequest::DemandClasses& Classes,
+		vector<int>& Greedy_Request);
+	//Precondition: Assignment holds the solution of the greedy engine of the requests of Classes.
+	//Postcondition: Greedy_Request[r - 1] is the request of Assignment (from 0) whose solution is given to the request r, so the
+	//    solutions of the identical requests are swapped to satisfy constraints27.
+
+	void getAssignment
+	(const IloNumArray& Link_Value,
+		const IloNumArray& Core_Value,
+		const IloNumArray& Index_Value,
+		const int TypeFlag,
+		const int Request_Number,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int C,
+		const int Slot_Flag,
+		const VONEILP::VarIndex& Index,
+		vector<vector<VONEGreedy::EdgeAssignment> >& Assignment);
+	//Precondition: Link_Value, Core_Value and Index_Value are the values of the link, core and start index (TypeFlag is 1 or 2) or
+	//    time slot (TypeFlag is 0) variables of the arc-flow formulation in a solution, Slot_Flag is the same as getSlotPosition.
+	//Postcondition: Assignment holds the links, cores and start indexes (or time slots) of each virtual edge of each request. The
+	//    virtual edges of a request on the same link take its selected cores of the link in their order.
+
+	//Two requests r1 < r2 sharing the link sd of the substrate network
+	struct PairLink
+	{
+		int _r1;
+		int _r2;
+		int _sd;
+	};
+
+	//The spectrum or time slots from _start to _end used by the request _request on a core of a link
+	struct Occupation
+	{
+		int _start;
+		int _end;
+		int _request;
+	};
+
+	bool less_pair_link(const PairLink& FirstPairLink, const PairLink& SecondPairLink);
+	//Postcondition: Return true if FirstPairLink is before SecondPairLink in the order of the link and then the requests
+
+	bool equal_pair_link(const PairLink& FirstPairLink, const PairLink& SecondPairLink);
+	//Postcondition: Return true if the two pair links have the same link and the same requests
+
+	bool less_occupation(const Occupation& FirstOccupation, const Occupation& SecondOccupation);
+	//Postcondition: Return true if FirstOccupation starts before SecondOccupation
+
+	void getViolatedPairLinks
+	(const IloNumArray& Core_Value,
+		const IloNumArray& Index_Value,
+		const int TypeFlag,
+		const int Request_Number,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index,
+		vector<PairLink>& Violated_Pair_Links);
+	//Precondition: Core_Value and Index_Value are the values of the core variables and the start index (TypeFlag is 1 or 2) or 
+	//    time slot (TypeFlag is 0) variables of the arc-flow formulation in a solution.
+	//Postcondition: Violated_Pair_Links holds every two requests whose spectrums or time slots overlap on the same core of a link
+	//    in the same direction, and each of them appears only once.
+
+	long long getNoOverlapRowNumber
+	(const int TypeFlag,
+		const int NoOverlap_Flag,
 		const int Request_Number,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Bandwidth,
-		const int C);
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links);
+	//Precondition: The same as constraints8, 9, 16 or 17 selected by TypeFlag and NoOverlap_Flag.
+	//Postcondition: Return the number of the no overlap constraints which are built by the selected constraints for all request pairs.
+
+	bool getGreedyStart
+	(IloNumVarArray Start_Variables,
+		IloNumArray Start_Values,
+		const IloBoolVarArray Node,
+		const IloBoolVarArray Link,
+		const IloBoolVarArray Core,
+		const IloIntVarArray Index_Variables,
+		const IloIntVarArray End,
+		const VONEGreedy::VONEGreedy& Greedy,
+		const int TypeFlag,
+		const int Request_Number,
+		const int Substrate_Network_Vertex_Number,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Vertex_Number,
+		const vector<vector<int> >& Computing_Capacity_in_Virtual_Vertexes,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int Slot_Flag,
+		const int Symmetry_Flag,
+		const vector<int>& Greedy_Request,
+		const VONEILP::VarIndex& Index);
+	//Precondition: Greedy has solved the requests of the arc-flow formulation whose node, link, core, start index (TypeFlag is 
+	//    1 or 2) or time slot (TypeFlag is 0) and spectrum end index (empty for TypeFlag 0) variables are Node, Link, Core, 
+	//    Index_Variables and End, Slot_Flag is the same as getSlotPosition.
+	//Postcondition: Return false if Greedy blocked a request or two virtual edges of a request share a core of a link, which the
+	//    arc-flow formulation can not express. Otherwise Start_Variables and Start_Values hold all these variables and their values
+	//    in the solution of Greedy, and the order variables of the no overlap constraints are left to CPLEX. If Symmetry_Flag is 1,
+	//    the cores of each link in each direction are relabelled in the order of their first request to satisfy constraints26. The 
+	//    request r takes the solution of the request Greedy_Request[r - 1] (from 0) of Greedy, or its own if it is empty.
+
+	template <class VarArray>
+	void addNewVariables(IloIntVarArray All_Variables, const VarArray x, const IloInt First);
+	//Postcondition: The variables of x from the position First have been appended to All_Variables
+
+	//Record the best bound of the root node when the branch and bound has not left the root node, and the time from Start_Time
+	//    and the objective of the first incumbent
+	ILOMIPINFOCALLBACK4(SolveInfoCallback, IloNum&, RootBound, IloNum, Start_Time, IloNum&, Incumbent_Time, IloNum&, Incumbent)
+	{
+		if (getNnodes() == 0)
+		{
+			RootBound = getBestObjValue();
+		}
+		if ((Incumbent_Time < 0) && hasIncumbent())
+		{
+			Incumbent_Time = (getCplexTime() - Start_Time) * 1000;
+			Incumbent = getIncumbentObjValue();
+		}
+	}
 }
 
 namespace VONEILP
 {
-	VONECplex::VONECplex()
+	ILPOption::ILPOption() :_nooverlap_flag(0), _hop_slack(-1), _path_number(0), _lazy_flag(0), _thread_number(1),
+		_name_flag(1), _export_flag(1), _start_flag(0), _window_size(0), _window_overlap(0),
+		_batch_size(0), _rebuild_flag(0), _slot_flag(0), _consistency_flag(0), _symmetry_flag(0), _aggregate_flag(0),
+		_column_round(100)
+	{
+
+	}
+
+	VONECplex::VONECplex() :_type_flag(0), _core_number(0), _substrate_edge_number(0), _occupied_flag(0), _build_time(0), _extract_time(0), 
+		_solve_time(0), _root_bound(0), _start_flag(0), _greedy_blocked_number(0), _greedy_time(0), _greedy_objective(0), _first_incumbent_time(-1), _first_incumbent(0),
+		_candidate_link_number(0), _pair_link_number(0), _candidate_pair_link_number(0), _batch_number(0), _added_request_number(0),
+		_lazy_round(0), _lazy_pair_link_number(0), _lazy_row_number(0), _full_row_number(0), _consistency_row_number(0), _offset_number(0),
+		_symmetry_row_number(0), _aggregate_row_number(0)
 	{
 		_model = IloModel(_env);
+		_hop_number = IloExpr(_env);
 		_variables = IloIntVarArray(_env);
 		_constraints = IloRangeArray(_env);
 		_cplex = IloCplex(_env);
 	}
 
 	void VONECplex::solve(const VONETopo::Topo& Substrate_Network,
-		const vector<VONETopo::Topo>& Virtual_Network_List, int TypeFlag, int CoreNum)
+		const VONERequest::RequestTable& Requests, int TypeFlag, int CoreNum, const ILPOption& Option,
+		const VONESpectrum::SpectrumOccupancy* Occupied)
 	{
+		//clock() is the CPU time of all threads on some platforms, so the wall time is used:
+		chrono::steady_clock::time_point build_start = chrono::steady_clock::now();
 		int RNum;
 		int SVNum;
 		vector<int> VVNum;
 		vector<int> AVVNum;
 		vector<vector<int> > C_r_v;
-		getILPVertexInputParameter(Substrate_Network, Virtual_Network_List, RNum, SVNum, VVNum, AVVNum, C_r_v);
+		getILPVertexInputParameter(Substrate_Network, Requests, RNum, SVNum, VVNum, AVVNum, C_r_v);
 
 		VONETopo::LinkList SGraph;
 		int SENum;
@@ -295,90 +1037,229 @@ namespace VONEILP
 		vector<int> VEBw;
 		vector<int> AVEBw;
 		vector<int> AVENumBw;
-		getILPEdgeInputParameter(Substrate_Network, Virtual_Network_List, SGraph, SENum, MinSEBw, VsGraph, VENum, 
+		getILPEdgeInputParameter(Substrate_Network, Requests, SGraph, SENum, MinSEBw, VsGraph, VENum, 
 			AVENum, VEBw, AVEBw, AVENumBw);
 
-		try
+		vector<vector<bool> > Candidate_r_s_d;
+		getCandidateLinks(SGraph, SVNum, VsGraph, C_r_v, Option._hop_slack, Candidate_r_s_d);
+		_variable_table.assign(SGraph, VENum, VEBw, TypeFlag, Option._name_flag);
+		_var_index.assign(RNum, SVNum, SENum, VVNum, AVVNum, VENum, AVENum, VEBw, AVENumBw, CoreNum);
+		_type_flag = TypeFlag;
+		_core_number = CoreNum;
+		_substrate_edge_number = SENum;
+		_virtual_edge_number = VENum;
+		_bandwidth = VEBw;
+		_option = Option;
+		//Only add_requests reads the input again, so it is only kept when batches will be added:
+		if (Option._batch_size > 0)
 		{
-			IloBoolVarArray Node_r_v_s(_env);
-			constraints1(Node_r_v_s, _constraints, RNum, SVNum, VVNum, AVVNum, C_r_v);
-			_variables.add(Node_r_v_s);
-
-			IloBoolVarArray Link_r_e_s_d(_env);
-			constraints2(Link_r_e_s_d, _constraints, RNum, SENum, VENum, AVENum, SGraph);
-			_variables.add(Link_r_e_s_d);
-			constraints3(_constraints, Link_r_e_s_d, Node_r_v_s, RNum, SENum, VENum, AVENum, SVNum, AVVNum, SGraph, VsGraph);
-			IloExpr Obj_1(_env);
-			for (IloInt i = 1; i <= Link_r_e_s_d.getSize(); i++)
-			{
-				Obj_1 += Link_r_e_s_d[i - 1];
-			}
+			_substrate_network = Substrate_Network;
+			_requests = Requests;
+		}
+		_occupied_flag = Occupied == 0 ? 0 : 1;
+		if (Occupied != 0)
+		{
+			_occupied = *Occupied;
+		}
+		count_candidate_links(RNum, SENum, Candidate_r_s_d);
 
+		try
+		{
 			string ModelLPFileName;
 			IloExpr Obj(_env);
-			if ((TypeFlag == 1) || (TypeFlag == 2))
+			if (Option._path_number > 0)
 			{
-				IloBoolVarArray Core_r_c_s_d(_env);
-				constraints4(Core_r_c_s_d, _constraints, Link_r_e_s_d, RNum, SENum, VENum, AVENum, SGraph, CoreNum);
-				_variables.add(Core_r_c_s_d);
+				for (int r = 1; r <= RNum; r++)
+				{
+					if (VENum[r - 1] != 1)
+					{
+						_env.error() << "The path formulation only supports the requests with one virtual edge.\n";
+						throw(-1);
+					}
+				}
+				if (Option._lazy_flag == 1)
+				{
+					_env.warning() << "The lazy no overlap constraints are only for the arc-flow formulation, all of them are built.\n";
+				}
+				if (Option._symmetry_flag == 1)
+				{
+					_env.warning() << "The core symmetry breaking is only for the arc-flow formulation, it is not built.\n";
+					_option._symmetry_flag = 0;
+				}
+				if (Occupied != 0)
+				{
+					_env.error() << "The occupied slots of the earlier requests are only for the arc-flow formulation.\n";
+					throw(-1);
+				}
+
+				vector<VONEPath::PathList> Path_r_k;
+				vector<int> APNum;
+				//The requests of the same vertex pair share the paths, which are computed once:
+				VONEPath::PathCache Paths(Substrate_Network, Option._path_number);
+				Paths.compute(Requests, Option._thread_number, Option._path_table);
+				ostringstream Path_Statistics;
+				Path_Statistics << Paths;
+				_path_statistics = Path_Statistics.str();
+				getCandidatePaths(Paths, VsGraph, C_r_v, Path_r_k, APNum);
+
+				IloBoolVarArray Path_r_k_var(_env);
+				constraints18(Path_r_k_var, _constraints, RNum, Path_r_k, APNum, _variable_table); //path selection
+				if (Option._aggregate_flag == 1)
+				{
+					_demand_classes.assign(Requests);
+					_aggregate_row_number += constraints28(_constraints, Path_r_k_var, RNum, Path_r_k, APNum, _demand_classes); //request ordering of the identical requests
+				}
+				_variables.add(Path_r_k_var);
+				for (int r = 1; r <= RNum; r++)
+				{
+					for (size_t k = 1; k <= Path_r_k[r - 1].size(); k++)
+					{
+						_hop_number += static_cast<int>(Path_r_k[r - 1][k - 1]._link.size()) * Path_r_k_var[APNum[r - 1] + k - 1];
+					}
+				}
+
+				IloBoolVarArray Core_r_k_c(_env);
+				constraints19(Core_r_k_c, _constraints, Path_r_k_var, RNum, Path_r_k, APNum, CoreNum,
+					_variable_table); //core selection on the path
+				_variables.add(Core_r_k_c);
+
+				IloBoolVarArray O_r1_r2(_env);
+				if ((TypeFlag == 1) || (TypeFlag == 2))
+				{
+					IloIntVarArray f_r(_env);
+					constraints20(f_r, _constraints, Path_r_k_var, RNum, Path_r_k, APNum, SGraph, VEBw,
+						_variable_table); //wavelength or frequency start index
+					_variables.add(f_r);
+
+					IloIntVarArray Ms_r(_env);
+					constraints21(Ms_r, _constraints, f_r, RNum, VEBw, _variable_table); //spectrum end index
+					_variables.add(Ms_r);
+
+					constraints23(O_r1_r2, _model, _constraints, Core_r_k_c, f_r, Path_r_k, APNum, SGraph, VEBw, CoreNum,
+						Option._nooverlap_flag, _variable_table); //spectrum no overlap
+					_variables.add(O_r1_r2);
 
-				IloIntVarArray f_r_e_s_d(_env);
-				constraints5(f_r_e_s_d, _model, Link_r_e_s_d, RNum, SENum, VENum, AVENum, SGraph, VEBw); //wavelength or frequency start index
-				_variables.add(f_r_e_s_d);
+					Obj = IloMax(Ms_r) + _hop_number;
+					ModelLPFileName = TypeFlag == 1 ? "WDMonMCFPath" : "OFDMonMCFPath";
+				}
+				else
+				{
+					IloIntVarArray t_r_slot(_env);
+					constraints22(t_r_slot, _constraints, Path_r_k_var, RNum, Path_r_k, APNum, SGraph, VEBw, AVEBw,
+						_variable_table); //time slot index
+					_variables.add(t_r_slot);
 
-				IloIntVarArray Ms_r_e_s_d(_env);
-				constraints7(Ms_r_e_s_d, _constraints, f_r_e_s_d, RNum, SENum, VENum, AVENum, SGraph, VEBw); //spectrum continuity
-				_variables.add(Ms_r_e_s_d);
+					constraints24(O_r1_r2, _model, _constraints, Core_r_k_c, t_r_slot, Path_r_k, APNum, SGraph, VEBw, AVEBw, CoreNum,
+						Option._nooverlap_flag, _variable_table); //time slot no overlap
+					_variables.add(O_r1_r2);
 
+					Obj = IloMax(t_r_slot) + _hop_number;
+					ModelLPFileName = "TDMonMCFPath";
+				}
 				_model.add(_variables);
 				_model.add(_constraints);
-				constraints8(_model, Core_r_c_s_d, f_r_e_s_d, RNum, SENum, VENum, AVENum, VEBw, CoreNum); //spectrum no overlap
-				//constraints10(_model, f_r_e_s_d, Link_r_e_s_d, RNum, SENum, VENum, AVENum); //spectrum consistency
-
-				Obj = IloMax(Ms_r_e_s_d) + Obj_1;
-				ModelLPFileName = TypeFlag == 1 ? "WDMonMCF" : "OFDMonMCF";
 			}
 			else
 			{
-				if (TypeFlag == 0)
+				//The occupied slots of the earlier requests tell the cores apart:
+				if ((Option._symmetry_flag == 1) && (Occupied != 0) && (Occupied->get_highest_slot() > 0))
+				{
+					_env.warning() << "The cores are not interchangeable with the occupied slots of the earlier requests, the core"
+						<< " symmetry breaking is not built.\n";
+					_option._symmetry_flag = 0;
+				}
+				if ((Option._slot_flag == 1) && (TypeFlag != 0))
+				{
+					_env.warning() << "The compact time slot formulation is only for TDM, the start indexes are built.\n";
+					_option._slot_flag = 0;
+				}
+				else if (Option._slot_flag == 1)
 				{
-					IloBoolVarArray Core_r_c_s_d(_env);
-					constraints4(Core_r_c_s_d, _constraints, Link_r_e_s_d, RNum, SENum, VENum, AVENum, SGraph, CoreNum);
-					_variables.add(Core_r_c_s_d);
+					for (int r = 1; r <= RNum; r++)
+					{
+						if (VENum[r - 1] != 1)
+						{
+							_env.error() << "The compact time slot formulation only supports the requests with one virtual edge.\n";
+							throw(-1);
+						}
+					}
+					if (Option._lazy_flag == 1)
+					{
+						_env.error() << "The compact time slot formulation builds all no overlap constraints, it is not for the lazy ones.\n";
+						throw(-1);
+					}
+				}
 
-					IloIntVarArray f_r_slot_e_s_d(_env);
-					constraints6(f_r_slot_e_s_d, _model, Link_r_e_s_d, RNum, SENum, VENum, AVENum, SGraph, VEBw, AVENumBw); //time slot start index
-					_variables.add(f_r_slot_e_s_d);
+				build_arc_flow(Substrate_Network, Requests, 1, RNum, SVNum, SENum, VVNum, C_r_v, SGraph, VsGraph, VENum,
+					VEBw, AVENumBw, Candidate_r_s_d, Obj);
+				ModelLPFileName = TypeFlag == 0 ? (_option._slot_flag == 1 ? "TDMonMCFCompact" : "TDMonMCF") :
+					(TypeFlag == 1 ? "WDMonMCF" : "OFDMonMCF");
+			}
+
+			_objective = IloMinimize(_env, Obj);
+			_model.add(_objective);
+			chrono::steady_clock::time_point build_end = chrono::steady_clock::now();
+			_build_time = chrono::duration<double, milli>(build_end - build_start).count();
 
-					_model.add(_variables);
-					_model.add(_constraints);
-					constraints9(_model, Core_r_c_s_d, f_r_slot_e_s_d, RNum, SENum, VENum, VEBw, AVENumBw, CoreNum); //spectrum no overlap					
-					constraints11(_model, f_r_slot_e_s_d, Link_r_e_s_d, RNum, SENum, VENum, AVENum, VEBw, AVENumBw); //time slot consistency
-					constraints12(_model, f_r_slot_e_s_d, Link_r_e_s_d, RNum, SENum, VENum, AVENum, VEBw, AVENumBw); //time slot order maintain
+			_cplex.extract(_model);
+			_extract_time = chrono::duration<double, milli>(chrono::steady_clock::now() - build_end).count();
+			if (Option._export_flag == 1)
+			{
+				//The .lp file needs the names, so the unnamed variables are named from their keys only here:
+				if (_variable_table.size() == static_cast<size_t>(_variables.getSize()))
+				{
+					for (IloInt i = 0; i < _variables.getSize(); i++)
+					{
+						_variables[i].setName(_variable_table.get_name(static_cast<size_t>(i)).c_str());
+					}
+				}
+				ModelLPFileName = ModelLPFileName + to_string(RNum) + ".lp";
+				_cplex.exportModel(ModelLPFileName.c_str());
+			}
 
-					/*//Another way to TDM time slot assignment:
-					IloIntVarArray f_r_slot(_env);
-					constraints13(f_r_slot, _constraints, RNum, MinSEBw, VEBw, AVEBw);
-					_variables.add(f_r_slot);
+			//The greedy solution is a feasible incumbent before the first node, the order variables are completed by CPLEX:
+			if ((Option._start_flag == 1) && (Option._path_number > 0))
+			{
+				_env.warning() << "The MIP start is only for the arc-flow formulation, the path formulation is solved from a cold model.\n";
+			}
+			else if ((Option._start_flag == 1) && (_option._consistency_flag == 1) && (TypeFlag != 0))
+			{
+				_env.warning() << "The greedy solution does not give the global offsets of the spectrum consistency of WDM or OFDM,"
+					<< " the ILP is solved from a cold model.\n";
+			}
+			else if (Option._start_flag == 1)
+			{
+				VONEGreedy::VONEGreedy Greedy;
+				Greedy.solve(Substrate_Network, Requests, TypeFlag, CoreNum, Occupied);
+				_greedy_time = Greedy.get_solve_time();
+				_greedy_blocked_number = Greedy.get_blocked_number();
+				_greedy_objective = Greedy.get_objective();
 
-					_model.add(_variables);
-					_model.add(_constraints);
-					constraints14(_model, f_r_slot, Node_r_v_s, RNum, SVNum, VVNum, AVVNum, C_r_v, VEBw, AVEBw);
-					constraints15(_model, Core_r_c_s_d, f_r_slot, RNum, SENum, VEBw, AVEBw, CoreNum);*/
+				//The identical requests take the greedy solutions in the order of constraints27:
+				vector<int> Greedy_Request;
+				if (_option._aggregate_flag == 1)
+				{
+					getClassOrder(Greedy.get_assignment(), _demand_classes, Greedy_Request);
+				}
 
-					Obj = IloMax(f_r_slot_e_s_d) + Obj_1;
-					ModelLPFileName = "TDMonMCF";
+				IloNumVarArray Start_Variables(_env);
+				IloNumArray Start_Values(_env);
+				if (getGreedyStart(Start_Variables, Start_Values, _node_variables, _link_variables, _core_variables, _index_variables,
+					_end_variables, Greedy, TypeFlag, RNum, SVNum, SENum, VVNum, C_r_v, VENum, VEBw, AVENumBw, _option._slot_flag,
+					_option._symmetry_flag, Greedy_Request, _var_index))
+				{
+					_cplex.addMIPStart(Start_Variables, Start_Values, IloCplex::MIPStartAuto, "Greedy");
+					_start_flag = 1;
 				}
 				else
 				{
-					cerr << "TypeFlag is wrong.\n The input model does not match the TypeFlag!\n";
+					_env.warning() << "The greedy solution is not a solution of the ILP (" << _greedy_blocked_number
+						<< " blocked requests), the ILP is solved from a cold model.\n";
 				}
+				Start_Variables.end();
+				Start_Values.end();
 			}
-
-			_model.add(IloMinimize(_env, Obj));
-			_cplex.extract(_model);
-			ModelLPFileName = ModelLPFileName + to_string(RNum) + ".lp";
-			_cplex.exportModel(ModelLPFileName.c_str());
+			_cplex.use(SolveInfoCallback(_env, _root_bound, _cplex.getCplexTime(), _first_incumbent_time, _first_incumbent));
 
 			//Some parameters to control the whole ILP solveing process:
 			//_cplex.setParam(IloCplex::Param::Emphasis::MIP, CPX_MIPEMPHASIS_BESTBOUND);
@@ -394,22 +1275,435 @@ namespace VONEILP
 			//_cplex.setParam(IloCplex::Param::MIP::Strategy::Search, 1);
 			//_cplex.setParam(IloCplex::Param::TimeLimit, 60);
 
+			chrono::steady_clock::time_point solve_start = chrono::steady_clock::now();
 			if (!_cplex.solve())
 			{
 				_env.error() << "Failed to optimize the RSCA ILP.\n";
 				throw(-1);
 			}
-		}
-		catch (IloException& e)
-		{
-			cerr << "Concert exception caught: " << e << endl;
-		}
+
+			//Add the no overlap constraints of the request pairs overlapping in the last solution and solve again, the constraints
+			//    of the request pairs which never overlap are not needed:
+			if ((Option._lazy_flag == 1) && (Option._path_number == 0))
+			{
+				set<long long> Added_Pair_Links;
+				while (true)
+				{
+					_lazy_round++;
+					IloNumArray Core_Value(_env), Index_Value(_env);
+					_cplex.getValues(Core_Value, _core_variables);
+					_cplex.getValues(Index_Value, _index_variables);
+					vector<PairLink> Violated_r1_r2_s_d;
+					getViolatedPairLinks(Core_Value, Index_Value, TypeFlag, RNum, SENum, VENum, VEBw, CoreNum, _var_index,
+						Violated_r1_r2_s_d);
+					Core_Value.end();
+					Index_Value.end();
+
+					IloBoolVarArray O_r1_r2_s_d(_env);
+					IloRangeArray NoOverlap_r1_r2_s_d(_env);
+					long long Added_Number = 0;
+					for (vector<PairLink>::const_iterator PairIT = Violated_r1_r2_s_d.begin(); PairIT != Violated_r1_r2_s_d.end(); PairIT++)
+					{
+						long long Key = (static_cast<long long>(PairIT->_r1 - 1) * RNum + (PairIT->_r2 - 1)) * SENum + (PairIT->_sd - 1);
+						if (!Added_Pair_Links.insert(Key).second)
+						{
+							continue;
+						}
+						Added_Number++;
+						if (Option._nooverlap_flag == 1)
+						{
+							_lazy_row_number += TypeFlag == 0 ?
+								addNoOverlap17(O_r1_r2_s_d, NoOverlap_r1_r2_s_d, _core_variables, _link_variables, _index_variables, 
+									PairIT->_r1, PairIT->_r2, PairIT->_sd, VENum, SGraph, VEBw, CoreNum, _variable_table, _var_index) :
+								addNoOverlap16(O_r1_r2_s_d, NoOverlap_r1_r2_s_d, _core_variables, _link_variables, _index_variables,
+									PairIT->_r1, PairIT->_r2, PairIT->_sd, VENum, SGraph, VEBw, CoreNum, _variable_table, _var_index);
+						}
+						else
+						{
+							_lazy_row_number += TypeFlag == 0 ?
+								addNoOverlap9(_model, _core_variables, _index_variables, PairIT->_r1, PairIT->_r2, PairIT->_sd, VENum,
+									VEBw, CoreNum, _var_index) :
+								addNoOverlap8(_model, _core_variables, _index_variables, PairIT->_r1, PairIT->_r2, PairIT->_sd, VENum,
+									VEBw, CoreNum, _var_index);
+						}
+					}
+					_env.out() << "Lazy round " << _lazy_round << ": " << Violated_r1_r2_s_d.size() << " overlapping request pairs on links, "
+						<< Added_Number << " new" << endl;
+					if (Added_Number == 0)
+					{
+						break;
+					}
+
+					_lazy_pair_link_number += Added_Number;
+					_variables.add(O_r1_r2_s_d);
+					_model.add(O_r1_r2_s_d);
+					_model.add(NoOverlap_r1_r2_s_d);
+					if (!_cplex.solve())
+					{
+						_env.error() << "Failed to optimize the RSCA ILP with the lazy no overlap constraints.\n";
+						throw(-1);
+					}
+				}
+			}
+			_solve_time = chrono::duration<double, milli>(chrono::steady_clock::now() - solve_start).count();
+		}
+		catch (IloException& e)
+		{
+			cerr << "Concert exception caught: " << e << endl;
+		}
+		catch (...)
+		{
+			cerr << "Unknown exception caught!\n";
+		}
+	}
+
+	void VONECplex::add_requests(const VONERequest::RequestTable& New_Requests)
+	{
+		chrono::steady_clock::time_point build_start = chrono::steady_clock::now();
+		try
+		{
+			if ((_option._path_number > 0) || (_option._lazy_flag == 1))
+			{
+				_env.error() << "The requests can only be added to the arc-flow formulation without the lazy no overlap constraints.\n";
+				throw(-1);
+			}
+			if (_option._batch_size <= 0)
+			{
+				_env.error() << "The requests can only be added to a model solved with a batch size, which keeps its input.\n";
+				throw(-1);
+			}
+
+			//The last solution is the MIP start of the new model, the variables of the new requests are completed by CPLEX:
+			IloIntVarArray Previous_Variables(_env);
+			IloNumArray Previous_Values(_env);
+			if ((_cplex.getStatus() == IloAlgorithm::Optimal) || (_cplex.getStatus() == IloAlgorithm::Feasible))
+			{
+				Previous_Variables.add(_variables);
+				_cplex.getValues(Previous_Values, _variables);
+			}
+
+			int Start_Request = static_cast<int>(_requests.size()) + 1;
+			_requests.append(New_Requests, 0, New_Requests.size());
+			int RNum;
+			int SVNum;
+			vector<int> VVNum;
+			vector<int> AVVNum;
+			vector<vector<int> > C_r_v;
+			getILPVertexInputParameter(_substrate_network, _requests, RNum, SVNum, VVNum, AVVNum, C_r_v);
+
+			VONETopo::LinkList SGraph;
+			int SENum;
+			int MinSEBw;
+			vector<VONETopo::LinkList> VsGraph;
+			vector<int> VENum;
+			vector<int> AVENum;
+			vector<int> VEBw;
+			vector<int> AVEBw;
+			vector<int> AVENumBw;
+			getILPEdgeInputParameter(_substrate_network, _requests, SGraph, SENum, MinSEBw, VsGraph, VENum,
+				AVENum, VEBw, AVEBw, AVENumBw);
+
+			//The parameters of the earlier requests are not changed, so the keys and the positions of their variables are kept:
+			vector<vector<bool> > Candidate_r_s_d;
+			getCandidateLinks(SGraph, SVNum, VsGraph, C_r_v, _option._hop_slack, Candidate_r_s_d);
+			_variable_table.extend(VENum, VEBw);
+			_var_index.assign(RNum, SVNum, SENum, VVNum, AVVNum, VENum, AVENum, VEBw, AVENumBw, _core_number);
+			_virtual_edge_number = VENum;
+			_bandwidth = VEBw;
+			count_candidate_links(RNum, SENum, Candidate_r_s_d);
+
+			IloExpr Obj(_env);
+			build_arc_flow(_substrate_network, _requests, Start_Request, RNum, SVNum, SENum, VVNum, C_r_v, SGraph, VsGraph, VENum,
+				VEBw, AVENumBw, Candidate_r_s_d, Obj);
+			_objective.setExpr(Obj);
+			Obj.end();
+
+			_cplex.deleteMIPStarts(0, _cplex.getNMIPStarts());
+			if (Previous_Variables.getSize() > 0)
+			{
+				_cplex.addMIPStart(Previous_Variables, Previous_Values, IloCplex::MIPStartAuto, "Previous");
+			}
+			Previous_Variables.end();
+			Previous_Values.end();
+			_batch_number++;
+			_added_request_number += static_cast<int>(New_Requests.size());
+
+			//The extracted model follows the added variables and constraints, so the extraction is a part of the building:
+			chrono::steady_clock::time_point solve_start = chrono::steady_clock::now();
+			_build_time = chrono::duration<double, milli>(solve_start - build_start).count();
+			_extract_time = 0;
+			_root_bound = 0;
+			_first_incumbent_time = -1;
+			_first_incumbent = 0;
+			_cplex.clearCallbacks();
+			_cplex.use(SolveInfoCallback(_env, _root_bound, _cplex.getCplexTime(), _first_incumbent_time, _first_incumbent));
+			if (!_cplex.solve())
+			{
+				_env.error() << "Failed to optimize the RSCA ILP with the added requests.\n";
+				throw(-1);
+			}
+			_solve_time = chrono::duration<double, milli>(chrono::steady_clock::now() - solve_start).count();
+		}
+		catch (IloException& e)
+		{
+			cerr << "Concert exception caught: " << e << endl;
+		}
 		catch (...)
 		{
 			cerr << "Unknown exception caught!\n";
 		}
 	}
 
+	double VONECplex::get_latency() const
+	{
+		return _build_time + _extract_time + _solve_time;
+	}
+
+	IloNum VONECplex::get_objective() const
+	{
+		return _cplex.getObjValue();
+	}
+
+	void VONECplex::build_arc_flow(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests,
+		const int Start_Request, const int RNum, const int SVNum, const int SENum, const vector<int>& VVNum, const vector<vector<int> >& C_r_v,
+		const VONETopo::LinkList& SGraph, const vector<VONETopo::LinkList>& VsGraph, const vector<int>& VENum, const vector<int>& VEBw,
+		const vector<int>& AVENumBw, const vector<vector<bool> >& Candidate_r_s_d, IloExpr& Obj)
+	{
+		if (Start_Request == 1)
+		{
+			_node_variables = IloBoolVarArray(_env);
+			_link_variables = IloBoolVarArray(_env);
+			_core_variables = IloBoolVarArray(_env);
+			_index_variables = IloIntVarArray(_env);
+			_end_variables = IloIntVarArray(_env);
+		}
+
+		//The variables of a request follow the ones of the earlier requests in each array, so the new ones start from these sizes:
+		IloInt Node_Size = _node_variables.getSize();
+		IloInt Link_Size = _link_variables.getSize();
+		IloInt Core_Size = _core_variables.getSize();
+		IloInt Index_Size = _index_variables.getSize();
+		IloInt End_Size = _end_variables.getSize();
+		IloIntVarArray New_Variables(_env);
+		IloRangeArray New_Constraints(_env);
+
+		constraints1(_node_variables, New_Constraints, RNum, Start_Request, SVNum, VVNum, C_r_v, _variable_table, _var_index);
+		addNewVariables(New_Variables, _node_variables, Node_Size);
+
+		constraints2(_link_variables, New_Constraints, RNum, Start_Request, SENum, VENum, Candidate_r_s_d,
+			_variable_table, _var_index);
+		addNewVariables(New_Variables, _link_variables, Link_Size);
+		constraints3(New_Constraints, _link_variables, _node_variables, RNum, Start_Request, VENum, SVNum,
+			Substrate_Network, VsGraph, _var_index);
+		for (IloInt i = Link_Size + 1; i <= _link_variables.getSize(); i++)
+		{
+			_hop_number += _link_variables[i - 1];
+		}
+		if (_option._aggregate_flag == 1)
+		{
+			_demand_classes.assign(Requests);
+			_aggregate_row_number += constraints27(New_Constraints, _link_variables, RNum, Start_Request, SENum, VENum, _demand_classes,
+				_var_index); //request ordering of the identical requests
+		}
+
+		if ((_type_flag == 1) || (_type_flag == 2))
+		{
+			constraints4(_core_variables, New_Constraints, _link_variables, RNum, Start_Request, SENum, VENum, _core_number,
+				_variable_table, _var_index);
+			addNewVariables(New_Variables, _core_variables, Core_Size);
+			if (_option._symmetry_flag == 1)
+			{
+				_symmetry_row_number += constraints26(New_Constraints, _core_variables, RNum, Start_Request, SENum, _core_number,
+					Candidate_r_s_d, _var_index); //core symmetry breaking
+			}
+
+			constraints5(_index_variables, _model, _link_variables, RNum, Start_Request, SENum, VENum, SGraph, VEBw,
+				_variable_table, _var_index); //wavelength or frequency start index
+			addNewVariables(New_Variables, _index_variables, Index_Size);
+
+			constraints7(_end_variables, New_Constraints, _index_variables, RNum, Start_Request, SENum, VENum, VEBw,
+				_variable_table, _var_index); //spectrum continuity
+			addNewVariables(New_Variables, _end_variables, End_Size);
+
+			if (_option._consistency_flag == 1)
+			{
+				IloIntVarArray g_r_e(_env);
+				_consistency_row_number += constraints10(g_r_e, New_Constraints, _index_variables, _link_variables, _type_flag, RNum,
+					Start_Request, SENum, VENum, SGraph, VEBw, Candidate_r_s_d, _variable_table, _var_index); //spectrum consistency
+				New_Variables.add(g_r_e);
+				_offset_number += g_r_e.getSize();
+			}
+
+			if ((_option._nooverlap_flag == 1) && (_option._lazy_flag == 0))
+			{
+				IloBoolVarArray O_r1_r2_e1_e2_s_d(_env);
+				constraints16(O_r1_r2_e1_e2_s_d, New_Constraints, _core_variables, _link_variables, _index_variables, RNum,
+					Start_Request, SENum, VENum, SGraph, VEBw, _core_number, Candidate_r_s_d, _option._thread_number, _variable_table,
+					_var_index); //linearized spectrum no overlap
+				New_Variables.add(O_r1_r2_e1_e2_s_d);
+			}
+
+			_variables.add(New_Variables);
+			_constraints.add(New_Constraints);
+			_model.add(New_Variables);
+			_model.add(New_Constraints);
+			if ((_option._nooverlap_flag == 0) && (_option._lazy_flag == 0))
+			{
+				constraints8(_model, _core_variables, _index_variables, RNum, Start_Request, SENum, VENum, VEBw, _core_number,
+					Candidate_r_s_d, _option._thread_number, _var_index); //spectrum no overlap
+			}
+			if (_occupied_flag == 1)
+			{
+				constraints25(_model, _core_variables, _index_variables, _type_flag, RNum, Start_Request, SENum, VENum, VEBw, AVENumBw,
+					_core_number, Candidate_r_s_d, _occupied, _option._slot_flag, _var_index); //spectrum no overlap with the earlier requests
+			}
+
+			//The earlier requests keep their spectrum, so the maximum index is at least their highest slot:
+			Obj = _occupied_flag == 0 ? IloMax(_end_variables) + _hop_number :
+				IloMax(IloMax(_end_variables), _occupied.get_highest_slot()) + _hop_number;
+		}
+		else
+		{
+			if (_type_flag == 0)
+			{
+				constraints4(_core_variables, New_Constraints, _link_variables, RNum, Start_Request, SENum, VENum,
+					_core_number, _variable_table, _var_index);
+				addNewVariables(New_Variables, _core_variables, Core_Size);
+				if (_option._symmetry_flag == 1)
+				{
+					_symmetry_row_number += constraints26(New_Constraints, _core_variables, RNum, Start_Request, SENum, _core_number,
+						Candidate_r_s_d, _var_index); //core symmetry breaking
+				}
+
+				//The compact formulation has one time slot variable for each slot of a request instead of each link, so the time slot
+				//    consistency is implied. Its requests have one virtual edge, so AVENumBw is the accumulated bandwidth:
+				if (_option._slot_flag == 1)
+				{
+					constraints13(_index_variables, New_Constraints, RNum, Start_Request, SGraph, VEBw, _variable_table); //time slot index
+					addNewVariables(New_Variables, _index_variables, Index_Size);
+					constraints14(New_Constraints, _index_variables, _link_variables, RNum, Start_Request, SENum, SGraph, VEBw, AVENumBw,
+						Candidate_r_s_d, _var_index); //time slot capacity
+
+					IloBoolVarArray O_r1_r2_slot1_slot2(_env);
+					constraints15(O_r1_r2_slot1_slot2, _model, New_Constraints, _core_variables, _index_variables, RNum, Start_Request, SENum,
+						SGraph, VEBw, AVENumBw, _core_number, Candidate_r_s_d, _option._nooverlap_flag, _option._thread_number,
+						_variable_table, _var_index); //time slot no overlap
+					New_Variables.add(O_r1_r2_slot1_slot2);
+
+					_variables.add(New_Variables);
+					_constraints.add(New_Constraints);
+					_model.add(New_Variables);
+					_model.add(New_Constraints);
+					if (_occupied_flag == 1)
+					{
+						constraints25(_model, _core_variables, _index_variables, _type_flag, RNum, Start_Request, SENum, VENum, VEBw,
+							AVENumBw, _core_number, Candidate_r_s_d, _occupied, 1, _var_index); //time slot no overlap with the earlier requests
+					}
+				}
+				else
+				{
+					constraints6(_index_variables, _model, _link_variables, RNum, Start_Request, SENum, VENum, SGraph, VEBw,
+						_variable_table, _var_index); //time slot start index
+					addNewVariables(New_Variables, _index_variables, Index_Size);
+
+					if ((_option._nooverlap_flag == 1) && (_option._lazy_flag == 0))
+					{
+						IloBoolVarArray O_r1_r2_slot1_slot2_e1_e2_s_d(_env);
+						constraints17(O_r1_r2_slot1_slot2_e1_e2_s_d, New_Constraints, _core_variables, _link_variables,
+							_index_variables, RNum, Start_Request, SENum, VENum, SGraph, VEBw, _core_number, Candidate_r_s_d,
+							_option._thread_number, _variable_table, _var_index); //linearized time slot no overlap
+						New_Variables.add(O_r1_r2_slot1_slot2_e1_e2_s_d);
+					}
+					if (_option._consistency_flag == 1)
+					{
+						IloIntVarArray g_r_slot_e(_env);
+						_consistency_row_number += constraints10(g_r_slot_e, New_Constraints, _index_variables, _link_variables, _type_flag,
+							RNum, Start_Request, SENum, VENum, SGraph, VEBw, Candidate_r_s_d, _variable_table, _var_index); //time slot consistency
+						New_Variables.add(g_r_slot_e);
+						_offset_number += g_r_slot_e.getSize();
+					}
+
+					_variables.add(New_Variables);
+					_constraints.add(New_Constraints);
+					_model.add(New_Variables);
+					_model.add(New_Constraints);
+					if ((_option._nooverlap_flag == 0) && (_option._lazy_flag == 0))
+					{
+						constraints9(_model, _core_variables, _index_variables, RNum, Start_Request, SENum, VENum, VEBw,
+							_core_number, Candidate_r_s_d, _option._thread_number, _var_index); //spectrum no overlap
+					}
+					if (_occupied_flag == 1)
+					{
+						constraints25(_model, _core_variables, _index_variables, _type_flag, RNum, Start_Request, SENum, VENum, VEBw,
+							AVENumBw, _core_number, Candidate_r_s_d, _occupied, 0, _var_index); //time slot no overlap with the earlier requests
+					}
+					if (_option._consistency_flag == 0)
+					{
+						_consistency_row_number += constraints11(_model, _index_variables, _link_variables, RNum, Start_Request, SENum,
+							VENum, VEBw, _option._thread_number, _var_index); //time slot consistency
+						_consistency_row_number += constraints12(_model, _index_variables, _link_variables, RNum, Start_Request,
+							SENum, VENum, VEBw, _var_index); //time slot order maintain
+					}
+				}
+
+				Obj = _occupied_flag == 0 ? IloMax(_index_variables) + _hop_number :
+					IloMax(IloMax(_index_variables), _occupied.get_highest_slot()) + _hop_number;
+			}
+			else
+			{
+				cerr << "TypeFlag is wrong.\n The input model does not match the TypeFlag!\n";
+			}
+		}
+
+		_full_row_number = getNoOverlapRowNumber(_type_flag, _option._nooverlap_flag, RNum, SENum, VENum, VEBw, _core_number,
+			Candidate_r_s_d);
+	}
+
+	void VONECplex::count_candidate_links(const int RNum, const int SENum, const vector<vector<bool> >& Candidate_r_s_d)
+	{
+		_pair_link_number = static_cast<long long>(RNum) * (RNum - 1) / 2 * SENum;
+		_candidate_pair_link_number = 0;
+		_candidate_link_number = 0;
+		for (int sd = 1; sd <= SENum; sd++)
+		{
+			long long Request_on_Link = 0;
+			for (int r = 1; r <= RNum; r++)
+			{
+				Request_on_Link += Candidate_r_s_d[r - 1][sd - 1] ? 1 : 0;
+			}
+			_candidate_link_number += Request_on_Link;
+			_candidate_pair_link_number += Request_on_Link * (Request_on_Link - 1) / 2;
+		}
+		_env.out() << "Candidate links: " << _candidate_link_number << " of " << static_cast<long long>(RNum) * SENum
+			<< ", request pairs on shared links: " << _candidate_pair_link_number << " of " << _pair_link_number << endl;
+	}
+
+	bool VONECplex::get_assignment(vector<vector<VONEGreedy::EdgeAssignment> >& Assignment)
+	{
+		Assignment.clear();
+		if ((_cplex.getStatus() != IloAlgorithm::Optimal) && (_cplex.getStatus() != IloAlgorithm::Feasible))
+		{
+			return false;
+		}
+
+		IloNumArray Link_Value(_env), Core_Value(_env), Index_Value(_env);
+		_cplex.getValues(Link_Value, _link_variables);
+		_cplex.getValues(Core_Value, _core_variables);
+		_cplex.getValues(Index_Value, _index_variables);
+		vector<int> Accumulate_Bandwidth(_bandwidth.size(), 0);
+		for (size_t r = 1; r < _bandwidth.size(); r++)
+		{
+			Accumulate_Bandwidth[r] = Accumulate_Bandwidth[r - 1] + _bandwidth[r - 1];
+		}
+		getAssignment(Link_Value, Core_Value, Index_Value, _type_flag, static_cast<int>(_virtual_edge_number.size()), 
+			_substrate_edge_number, _virtual_edge_number, _bandwidth, Accumulate_Bandwidth, _core_number, _option._slot_flag, _var_index,
+			Assignment);
+		Link_Value.end();
+		Core_Value.end();
+		Index_Value.end();
+		return true;
+	}
+
 	ostream& operator <<(ostream& outs, VONECplex& VONEILP)
 	{
 		IloNumArray _values(VONEILP._env);
@@ -418,28 +1712,79 @@ namespace VONEILP
 
 		VONEILP._env.out() << "Solution Status = " << VONEILP._cplex.getStatus() << endl;
 		VONEILP._env.out() << "Solution Objective Value Maximum M = " << VONEILP._cplex.getObjValue() << endl;
+		VONEILP._env.out() << "Model Rows = " << VONEILP._cplex.getNrows() << ", Columns = " << VONEILP._cplex.getNcols()
+			<< ", Binaries = " << VONEILP._cplex.getNbinVars() << ", Integers = " << VONEILP._cplex.getNintVars() << endl;
+		VONEILP._env.out() << "Model Building Time = " << VONEILP._build_time << "ms, Extracting Time = " << VONEILP._extract_time
+			<< "ms, Solving Time = " << VONEILP._solve_time << "ms" << endl;
+		VONEILP._env.out() << "Root Node Bound = " << VONEILP._root_bound << ", Final Bound = " << VONEILP._cplex.getBestObjValue()
+			<< ", Branch Nodes = " << VONEILP._cplex.getNnodes() << endl;
+		if (VONEILP._start_flag == 1)
+		{
+			VONEILP._env.out() << "MIP Start = Greedy, Objective = " << VONEILP._greedy_objective << ", Greedy Time = "
+				<< VONEILP._greedy_time << "ms" << endl;
+		}
+		else
+		{
+			VONEILP._env.out() << "MIP Start = None" << endl;
+		}
+		VONEILP._env.out() << "First Incumbent Time = " << VONEILP._first_incumbent_time << "ms, First Incumbent = "
+			<< VONEILP._first_incumbent << ", Final Gap = " << VONEILP._cplex.getMIPRelativeGap() << endl;
+		VONEILP._env.out() << VONEILP._path_statistics;
+		VONEILP._env.out() << "Candidate Links = " << VONEILP._candidate_link_number << ", Request Pairs on Shared Links = "
+			<< VONEILP._candidate_pair_link_number << " of " << VONEILP._pair_link_number << endl;
+		if ((VONEILP._consistency_row_number > 0) || (VONEILP._offset_number > 0))
+		{
+			VONEILP._env.out() << "Consistency Constraints = " << VONEILP._consistency_row_number << ", Global Offsets = "
+				<< VONEILP._offset_number << endl;
+		}
+		if (VONEILP._option._symmetry_flag == 1)
+		{
+			VONEILP._env.out() << "Core Symmetry Breaking Constraints = " << VONEILP._symmetry_row_number << endl;
+		}
+		if (VONEILP._option._aggregate_flag == 1)
+		{
+			VONEILP._env.out() << VONEILP._demand_classes;
+			VONEILP._env.out() << "Request Ordering Constraints = " << VONEILP._aggregate_row_number << endl;
+		}
+		if (VONEILP._batch_number > 0)
+		{
+			VONEILP._env.out() << "Added Batches = " << VONEILP._batch_number << ", Added Requests = " << VONEILP._added_request_number
+				<< ", the times above are of the last batch" << endl;
+		}
+		if (VONEILP._lazy_round > 0)
+		{
+			VONEILP._env.out() << "Lazy Rounds = " << VONEILP._lazy_round << ", Request Pairs on Links with No Overlap Constraints = "
+				<< VONEILP._lazy_pair_link_number << ", No Overlap Constraints = " << VONEILP._lazy_row_number << " of "
+				<< VONEILP._full_row_number << endl;
+		}
+		if (VONEILP._variable_table.get_name_flag() == 1)
+		{
+			VONEILP._env.out() << "Variable Names Built = " << VONEILP._variable_table.get_name_number() << ", Name Bytes = "
+				<< VONEILP._variable_table.get_name_bytes() << endl;
+		}
+		else
+		{
+			VONEILP._env.out() << "Variable Keys Recorded = " << VONEILP._variable_table.size() << ", Key Bytes = "
+				<< VONEILP._variable_table.size() * sizeof(VONEILP::VariableKey) << endl;
+		}
+		//The variables of the arc-flow formulation are named from their keys when they are not named:
+		bool Key_Name = VONEILP._variable_table.size() == static_cast<size_t>(VONEILP._variables.getSize());
 		VONEILP._env.out() << "Solution Variables Value are following:\n";
 		VONEILP._env.out() << left << setw(30) << "Variable Name" << "Value" << endl;
 
-		int LinkNum = 0;
 		for (int i = 0; i < _values.getSize(); i++)
 		{
 			if (_values[i] != 0)
 			{
-				string VarName = VONEILP._variables[i].getName();
-				if (VarName[0] != 'M')
+				string VarName = Key_Name ? VONEILP._variable_table.get_name(static_cast<size_t>(i)) : VONEILP._variables[i].getName();
+				if ((VarName[0] != 'M') && (VarName[0] != 'O'))
 				{
 					VONEILP._env.out() << left << setw(30) << VarName
 						<< _values[i] << endl;
 				}
-				 
-				if (VarName[0] == 'x')
-				{
-					LinkNum += 1;
-				}
 			}
 		}
-		VONEILP._env.out() << "Ms = " << VONEILP._cplex.getObjValue() - LinkNum << endl;
+		VONEILP._env.out() << "Ms = " << VONEILP._cplex.getObjValue() - VONEILP._cplex.getValue(VONEILP._hop_number) << endl;
 		return outs;
 	}
 
@@ -452,7 +1797,7 @@ namespace
 {
 	void getILPVertexInputParameter
 	(const VONETopo::Topo& Substrate_Network,
-		const vector<VONETopo::Topo>& Virtual_Network_List,
+		const VONERequest::RequestTable& Requests,
 		int& Request_Number,
 		int& Substrate_Network_Vertex_Number,
 		vector<int>& Virtual_Networks_Vertex_Number,
@@ -464,36 +1809,18 @@ namespace
 
 		Substrate_Network_Vertex_Number = static_cast<int>(Substrate_Network_NodeList.size());
 
-		Request_Number = static_cast<int>(Virtual_Network_List.size());
+		Request_Number = static_cast<int>(Requests.size());
 
+		//A request is a virtual network of the vertexes 1 and 2, whose computing capacities are the substrate vertexes they are
+		//    mapped to:
+		Virtual_Networks_Vertex_Number.assign(Request_Number, 2);
+		Accumulate_Virtual_Networks_Vertex_Number.resize(Request_Number);
 		Computing_Capacity_in_Virtual_Vertexes.resize(Request_Number);
-
-		for (vector<VONETopo::Topo>::const_iterator TopoIT = Virtual_Network_List.begin();
-			TopoIT != Virtual_Network_List.end(); TopoIT++)
+		for (int r = 1; r <= Request_Number; r++)
 		{
-			VONETopo::NodeList Virtual_Network_NodeList;
-			TopoIT->get_vertex(Virtual_Network_NodeList);
-			Virtual_Networks_Vertex_Number.push_back(static_cast<int>(Virtual_Network_NodeList.size()));
-
-			int request_index = static_cast<int>(TopoIT - Virtual_Network_List.begin() + 1);
-
-			if (request_index == 1)
-			{
-				Accumulate_Virtual_Networks_Vertex_Number.push_back(0);
-			}
-			else
-			{
-
-				int Sum = accumulate(Virtual_Networks_Vertex_Number.begin(),
-					Virtual_Networks_Vertex_Number.begin() + request_index - 1, 0);
-				Accumulate_Virtual_Networks_Vertex_Number.push_back(Sum);
-			}
-
-			for (VONETopo::NodeListIT VNTopoIT = Virtual_Network_NodeList.begin();
-				VNTopoIT != Virtual_Network_NodeList.end(); VNTopoIT++)
-			{
-				Computing_Capacity_in_Virtual_Vertexes[request_index - 1].push_back(VNTopoIT->_vertex_computing_capacity);
-			}
+			Accumulate_Virtual_Networks_Vertex_Number[r - 1] = 2 * (r - 1);
+			Computing_Capacity_in_Virtual_Vertexes[r - 1].assign(1, Requests.get_source(r - 1));
+			Computing_Capacity_in_Virtual_Vertexes[r - 1].push_back(Requests.get_destination(r - 1));
 		}
 	}
 
@@ -501,33 +1828,29 @@ namespace
 	(IloBoolVarArray x,
 		IloRangeArray c,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Vertex_Number,
-		const vector<int> Virtual_Networks_Vertex_Number,
-		const vector<int> Accumulate_Virtual_Networks_Vertex_Number,
-		const vector<vector<int> > Computing_Capacity_in_Virtual_Vertexes)
+		const vector<int>& Virtual_Networks_Vertex_Number,
+		const vector<vector<int> >& Computing_Capacity_in_Virtual_Vertexes,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
 	{
 		IloEnv env = c.getEnv();
-		string Variable = "y_";
-		for (int r = 1; r <= Request_Number; r++)
+		for (int r = Start_Request; r <= Request_Number; r++)
 		{
 			for (int v = 1; v <= Virtual_Networks_Vertex_Number[r - 1]; v++)
 			{
 				IloExpr con1(env);
 				for (int s = 1; s <= Substrate_Network_Vertex_Number; s++)
 				{
-					string Variable_Name = Variable + to_string(r) + "_" + to_string(v) + "_" + to_string(s);
-					x.add(IloBoolVar(env, Variable_Name.c_str()));
+					x.add(IloBoolVar(env, Table.add(VONEILP::VariableKey('y', r, v, s, 0, 0))));
 					if (s == Computing_Capacity_in_Virtual_Vertexes[r - 1][v - 1])
 					{
-						c.add(x[(s - 1)
-							+ (v - 1) * Substrate_Network_Vertex_Number
-							+ Substrate_Network_Vertex_Number * Accumulate_Virtual_Networks_Vertex_Number[r - 1]] == 1);
+						c.add(x[Index.node(r, v, s)] == 1);
 					}
 					else
 					{
-						c.add(x[(s - 1)
-							+ (v - 1) * Substrate_Network_Vertex_Number
-							+ Substrate_Network_Vertex_Number * Accumulate_Virtual_Networks_Vertex_Number[r - 1]] == 0);
+						c.add(x[Index.node(r, v, s)] == 0);
 					}
 				}
 			}
@@ -536,7 +1859,7 @@ namespace
 
 	void getILPEdgeInputParameter
 	(const VONETopo::Topo& Substrate_Network,
-		const vector<VONETopo::Topo>& Virtual_Network_List,
+		const VONERequest::RequestTable& Requests,
 		VONETopo::LinkList& Substrate_Network_Edge,
 		int& Substrate_Network_Edge_Number,
 		int& Min_Substrate_Network_Bandwidth,
@@ -558,16 +1881,15 @@ namespace
 		Min_Substrate_Network_Bandwidth = *min_element(Substrate_Network_Bandwidth.begin(),
 			Substrate_Network_Bandwidth.end());
 
-		for (vector<VONETopo::Topo>::const_iterator VNTopoIT = Virtual_Network_List.begin();
-			VNTopoIT != Virtual_Network_List.end(); VNTopoIT++)
+		//A request is the virtual edge 1 from the virtual vertex 1 to 2:
+		int Request_Number = static_cast<int>(Requests.size());
+		for (int request_index = 1; request_index <= Request_Number; request_index++)
 		{
-			VONETopo::LinkList Virtual_Network_EdgeList;
-			VNTopoIT->get_edge(Virtual_Network_EdgeList);
-			Virtual_Networks_Edge.push_back(Virtual_Network_EdgeList);
-			Virtual_Networks_Edge_Number.push_back(static_cast<int>(Virtual_Network_EdgeList.size()));
-			Virtual_Networks_Bandwidth.push_back(Virtual_Network_EdgeList[0]._edge_bandwidth);
-
-			int request_index = static_cast<int>(VNTopoIT - Virtual_Network_List.begin() + 1);
+			VONETopo::Edge Virtual_Network_Edge = { 1, { 1, Requests.get_source(request_index - 1) },
+				{ 2, Requests.get_destination(request_index - 1) }, Requests.get_width(request_index - 1) };
+			Virtual_Networks_Edge.push_back(VONETopo::LinkList(1, Virtual_Network_Edge));
+			Virtual_Networks_Edge_Number.push_back(1);
+			Virtual_Networks_Bandwidth.push_back(Virtual_Network_Edge._edge_bandwidth);
 
 			if (request_index == 1)
 			{
@@ -587,38 +1909,112 @@ namespace
 		}
 	}
 
+	void getHopDistance
+	(const vector<vector<int> >& Adjacent_Vertexes,
+		const int Source,
+		vector<int>& Hop_Distance)
+	{
+		Hop_Distance.assign(Adjacent_Vertexes.size(), -1);
+		queue<int> Vertex_Queue;
+		Hop_Distance[Source - 1] = 0;
+		Vertex_Queue.push(Source);
+		while (!Vertex_Queue.empty())
+		{
+			int s = Vertex_Queue.front();
+			Vertex_Queue.pop();
+			for (vector<int>::const_iterator AdjIT = Adjacent_Vertexes[s - 1].begin();
+				AdjIT != Adjacent_Vertexes[s - 1].end(); AdjIT++)
+			{
+				if (Hop_Distance[*AdjIT - 1] < 0)
+				{
+					Hop_Distance[*AdjIT - 1] = Hop_Distance[s - 1] + 1;
+					Vertex_Queue.push(*AdjIT);
+				}
+			}
+		}
+	}
+
+	void getCandidateLinks
+	(const VONETopo::LinkList& Substrate_Network_Edge,
+		const int Substrate_Network_Vertex_Number,
+		const vector<VONETopo::LinkList>& Virtual_Networks_Edge,
+		const vector<vector<int> >& Computing_Capacity_in_Virtual_Vertexes,
+		const int Hop_Slack,
+		vector<vector<bool> >& Candidate_Links)
+	{
+		int Request_Number = static_cast<int>(Virtual_Networks_Edge.size());
+		int Substrate_Network_Edge_Number = static_cast<int>(Substrate_Network_Edge.size());
+		Candidate_Links.assign(Request_Number, vector<bool>(Substrate_Network_Edge_Number, Hop_Slack < 0));
+		if (Hop_Slack < 0)
+		{
+			return;
+		}
+
+		vector<vector<int> > Adjacent_Vertexes(Substrate_Network_Vertex_Number);
+		for (VONETopo::LinkListIT SNTopoIT = Substrate_Network_Edge.begin();
+			SNTopoIT != Substrate_Network_Edge.end(); SNTopoIT++)
+		{
+			Adjacent_Vertexes[SNTopoIT->_edge_source._vertex_id - 1].push_back(SNTopoIT->_edge_destination._vertex_id);
+			Adjacent_Vertexes[SNTopoIT->_edge_destination._vertex_id - 1].push_back(SNTopoIT->_edge_source._vertex_id);
+		}
+
+		vector<int> Source_Distance, Destination_Distance;
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			for (VONETopo::LinkListIT VNTopoIT = Virtual_Networks_Edge[r - 1].begin();
+				VNTopoIT != Virtual_Networks_Edge[r - 1].end(); VNTopoIT++)
+			{
+				//The computing capacity of a virtual vertex is the substrate vertex it is mapped to:
+				int Source = Computing_Capacity_in_Virtual_Vertexes[r - 1][VNTopoIT->_edge_source._vertex_id - 1];
+				int Destination = Computing_Capacity_in_Virtual_Vertexes[r - 1][VNTopoIT->_edge_destination._vertex_id - 1];
+				getHopDistance(Adjacent_Vertexes, Source, Source_Distance);
+				getHopDistance(Adjacent_Vertexes, Destination, Destination_Distance);
+				if (Source_Distance[Destination - 1] < 0)
+				{
+					continue;
+				}
+
+				int Hop_Bound = Source_Distance[Destination - 1] + Hop_Slack;
+				for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+				{
+					int s = Substrate_Network_Edge[sd - 1]._edge_source._vertex_id;
+					int d = Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id;
+					int Forward_Hop = Source_Distance[s - 1] + 1 + Destination_Distance[d - 1];
+					int Backward_Hop = Source_Distance[d - 1] + 1 + Destination_Distance[s - 1];
+					if (((Source_Distance[s - 1] >= 0) && (Destination_Distance[d - 1] >= 0) && (Forward_Hop <= Hop_Bound))
+						|| ((Source_Distance[d - 1] >= 0) && (Destination_Distance[s - 1] >= 0) && (Backward_Hop <= Hop_Bound)))
+					{
+						Candidate_Links[r - 1][sd - 1] = true;
+					}
+				}
+			}
+		}
+	}
+
 	void constraints2
 	(IloBoolVarArray x,
 		IloRangeArray c,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const VONETopo::LinkList& Substrate_Network_Edge)
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<vector<bool> >& Candidate_Links,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
 	{
 		IloEnv env = c.getEnv();
-		string Variable = "x_";
-		for (int r = 1; r <= Request_Number; r++)
+		for (int r = Start_Request; r <= Request_Number; r++)
 		{
 			for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
 			{
 				IloExpr con4(env);
 				for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
 				{
-					string Variable_Name = Variable + to_string(r) + "_" + to_string(e) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_source._vertex_id) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id);
-					x.add(IloBoolVar(env, Variable_Name.c_str()));
-					Variable_Name = Variable + to_string(r) + "_" + to_string(e) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_source._vertex_id);
-					x.add(IloBoolVar(env, Variable_Name.c_str()));
-					con4 += x[2 * (e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number]
-						+ x[(2 * e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number];
+					int Upper_Bound = Candidate_Links[r - 1][sd - 1] ? 1 : 0;
+					x.add(IloBoolVar(env, 0, Upper_Bound, Table.add(VONEILP::VariableKey('x', r, e, 0, sd, 0))));
+					x.add(IloBoolVar(env, 0, Upper_Bound, Table.add(VONEILP::VariableKey('x', r, e, 0, sd, 1))));
+					con4 += x[Index.edge(r, e, sd, 0)]
+						+ x[Index.edge(r, e, sd, 1)];
 				}
 				c.add(con4 <= 1);
 			}
@@ -630,49 +2026,38 @@ namespace
 		const IloBoolVarArray x,
 		const IloBoolVarArray y,
 		const int Request_Number,
-		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
+		const int Start_Request,
+		const vector<int>& Virtual_Networks_Edge_Number,
 		const int Substrate_Network_Vertex_Number,
-		const vector<int> Accumulate_Virtual_Networks_Vertex_Number,
-		const VONETopo::LinkList& Substrate_Network_Edge,
-		const vector<VONETopo::LinkList>& Virtual_Networks_Edge)
+		const VONETopo::Topo& Substrate_Network,
+		const vector<VONETopo::LinkList>& Virtual_Networks_Edge,
+		const VONEILP::VarIndex& Index)
 	{
+		//Only the links of s are in its flow conservation, so they are read from the incidence lists of s:
 		IloEnv env = c.getEnv();
-		for (int r = 1; r <= Request_Number; r++)
+		const VONETopo::Adjacency& Incidence = Substrate_Network.get_adjacency();
+		for (int r = Start_Request; r <= Request_Number; r++)
 		{
 			for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
 			{
 				for (int s = 1; s <= Substrate_Network_Vertex_Number; s++)
 				{
 					IloExpr con5(env);
-					for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+					int v = Substrate_Network.find_vertex(s);
+					for (int i = Incidence._out_offset[v]; i < Incidence._out_offset[v + 1]; i++)
 					{
-						if (Substrate_Network_Edge[sd - 1]._edge_source._vertex_id == s)
-						{
-							con5 += x[2 * (e - 1)
-								+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number]
-								- x[(2 * e - 1)
-								+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number];
-						}
-
-						if (Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id == s)
-						{
-							con5 += x[(2 * e - 1)
-								+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number]
-								- x[2 * (e - 1)
-								+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number];
-						}
+						int sd = Incidence._out_edge[i];
+						con5 += x[Index.edge(r, e, sd, 0)]
+							- x[Index.edge(r, e, sd, 1)];
+					}
+					for (int i = Incidence._in_offset[v]; i < Incidence._in_offset[v + 1]; i++)
+					{
+						int sd = Incidence._in_edge[i];
+						con5 += x[Index.edge(r, e, sd, 1)]
+							- x[Index.edge(r, e, sd, 0)];
 					}
-					c.add(con5 - y[(s - 1)
-						+ (Virtual_Networks_Edge[r - 1][e - 1]._edge_source._vertex_id - 1) * Substrate_Network_Vertex_Number
-						+ Substrate_Network_Vertex_Number * Accumulate_Virtual_Networks_Vertex_Number[r - 1]] + y[(s - 1)
-						+ (Virtual_Networks_Edge[r - 1][e - 1]._edge_destination._vertex_id - 1) * Substrate_Network_Vertex_Number
-						+ Substrate_Network_Vertex_Number * Accumulate_Virtual_Networks_Vertex_Number[r - 1]] == 0);
+					c.add(con5 - y[Index.node(r, Virtual_Networks_Edge[r - 1][e - 1]._edge_source._vertex_id, s)]
+						+ y[Index.node(r, Virtual_Networks_Edge[r - 1][e - 1]._edge_destination._vertex_id, s)] == 0);
 				}
 			}
 		}
@@ -683,46 +2068,32 @@ namespace
 		IloRangeArray con,
 		const IloBoolVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const VONETopo::LinkList& Substrate_Network_Edge,
-		const int C)
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const int C,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
 	{
 		IloEnv env = con.getEnv();
-		string Variable = "X_";
-		for (int r = 1; r <= Request_Number; r++)
+		for (int r = Start_Request; r <= Request_Number; r++)
 		{
 			for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
 			{
 				IloExpr con6_1(env), con6_2(env);
 				for (int c = 1; c <= C; c++)
 				{
-					string Variable_Name = Variable + to_string(r) + "_" + to_string(c) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_source._vertex_id) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id);
-					x.add(IloBoolVar(env, Variable_Name.c_str()));
-					Variable_Name = Variable + to_string(r) + "_" + to_string(c) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_source._vertex_id);
-					x.add(IloBoolVar(env, Variable_Name.c_str()));
-					con6_1 += x[2 * (c - 1)
-						+ (sd - 1) * C * 2
-						+ (r - 1) * C * 2 * Substrate_Network_Edge_Number];
-					con6_2 += x[(2 * c - 1)
-						+ (sd - 1) * C * 2
-						+ (r - 1) * C * 2 * Substrate_Network_Edge_Number];
+					x.add(IloBoolVar(env, Table.add(VONEILP::VariableKey('X', r, c, 0, sd, 0))));
+					x.add(IloBoolVar(env, Table.add(VONEILP::VariableKey('X', r, c, 0, sd, 1))));
+					con6_1 += x[Index.core(r, c, sd, 0)];
+					con6_2 += x[Index.core(r, c, sd, 1)];
 				}
 
 				IloExpr con6_1_right(env), con6_2_right(env);
 				for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
 				{
-					con6_1_right += y[2 * (e - 1)
-						+ (sd - 1) *  Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number];
-					con6_2_right += y[(2 * e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number];
+					con6_1_right += y[Index.edge(r, e, sd, 0)];
+					con6_2_right += y[Index.edge(r, e, sd, 1)];
 				}
 
 				con.add(con6_1 - con6_1_right == 0);
@@ -736,56 +2107,35 @@ namespace
 		IloModel mod,
 		const IloBoolVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
 		const VONETopo::LinkList& Substrate_Network_Edge,
-		const vector<int> Virtual_Networks_Bandwidth)
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
 	{
 		IloEnv env = mod.getEnv();
-		string Variable = "f_";
-		for (int r = 1; r <= Request_Number; r++)
+		for (int r = Start_Request; r <= Request_Number; r++)
 		{
 			for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
 			{
 				for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
 				{
-					string Variable_Name = Variable + to_string(r) + "_" + to_string(e) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_source._vertex_id) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id);
 					x.add(IloIntVar(env, 0, Substrate_Network_Edge[sd-1]._edge_bandwidth + 
-						1 - Virtual_Networks_Bandwidth[r - 1], Variable_Name.c_str()));
-					Variable_Name = Variable + to_string(r) + "_" + to_string(e) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_source._vertex_id);
+						1 - Virtual_Networks_Bandwidth[r - 1], Table.add(VONEILP::VariableKey('f', r, e, 0, sd, 0))));
 					x.add(IloIntVar(env, 0, Substrate_Network_Edge[sd - 1]._edge_bandwidth +
-						1 - Virtual_Networks_Bandwidth[r - 1], Variable_Name.c_str()));
-
-					mod.add(IloIfThen(env, y[2 * (e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 0, 
-						x[2 * (e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 0));
-					mod.add(IloIfThen(env, y[(2 * e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 0, 
-						x[(2 * e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 0));
+						1 - Virtual_Networks_Bandwidth[r - 1], Table.add(VONEILP::VariableKey('f', r, e, 0, sd, 1))));
+
+					mod.add(IloIfThen(env, y[Index.edge(r, e, sd, 0)] == 0, 
+						x[Index.edge(r, e, sd, 0)] == 0));
+					mod.add(IloIfThen(env, y[Index.edge(r, e, sd, 1)] == 0, 
+						x[Index.edge(r, e, sd, 1)] == 0));
 					
-					mod.add(IloIfThen(env, y[2 * (e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 1,
-						x[2 * (e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] >= 1));
-					mod.add(IloIfThen(env, y[(2 * e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 1,
-						x[(2 * e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] >= 1));
+					mod.add(IloIfThen(env, y[Index.edge(r, e, sd, 0)] == 1,
+						x[Index.edge(r, e, sd, 0)] >= 1));
+					mod.add(IloIfThen(env, y[Index.edge(r, e, sd, 1)] == 1,
+						x[Index.edge(r, e, sd, 1)] >= 1));
 				}
 			}
 		}
@@ -796,16 +2146,16 @@ namespace
 		IloModel mod,
 		const IloBoolVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
 		const VONETopo::LinkList& Substrate_Network_Edge,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Bandwidth)
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
 	{
 		IloEnv env = mod.getEnv();
-		string Variable = "t_";
-		for (int r = 1; r <= Request_Number; r++)
+		for (int r = Start_Request; r <= Request_Number; r++)
 		{
 			for (int slot = 1; slot <= Virtual_Networks_Bandwidth[r - 1]; slot++)
 			{
@@ -813,46 +2163,20 @@ namespace
 				{
 					for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
 					{
-						string Variable_Name = Variable + to_string(r) + "_" + to_string(slot) + "_"
-							+ to_string(e) + "_" + to_string(Substrate_Network_Edge[sd - 1]._edge_source._vertex_id) + "_"
-							+ to_string(Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id);
 						x.add(IloIntVar(env, 0, Substrate_Network_Edge[sd - 1]._edge_bandwidth,
-							Variable_Name.c_str()));
-						Variable_Name = Variable + to_string(r) + "_" + to_string(slot) + "_"
-							+ to_string(e) + "_" + to_string(Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id) + "_"
-							+ to_string(Substrate_Network_Edge[sd - 1]._edge_source._vertex_id);
+							Table.add(VONEILP::VariableKey('t', r, slot, e, sd, 0))));
 						x.add(IloIntVar(env, 0, Substrate_Network_Edge[sd - 1]._edge_bandwidth,
-							Variable_Name.c_str()));
-
-						mod.add(IloIfThen(env, y[2 * (e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 0,
-							x[2 * (e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-							+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] == 0));
-						mod.add(IloIfThen(env, y[(2 * e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 0,
-							x[(2 * e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-							+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] == 0));
-
-						mod.add(IloIfThen(env, y[2 * (e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 1,
-							x[2 * (e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-							+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] >= 1));
-						mod.add(IloIfThen(env, y[(2 * e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 1,
-							x[(2 * e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-							+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] >= 1));
+							Table.add(VONEILP::VariableKey('t', r, slot, e, sd, 1))));
+
+						mod.add(IloIfThen(env, y[Index.edge(r, e, sd, 0)] == 0,
+							x[Index.slot(r, slot, e, sd, 0)] == 0));
+						mod.add(IloIfThen(env, y[Index.edge(r, e, sd, 1)] == 0,
+							x[Index.slot(r, slot, e, sd, 1)] == 0));
+
+						mod.add(IloIfThen(env, y[Index.edge(r, e, sd, 0)] == 1,
+							x[Index.slot(r, slot, e, sd, 0)] >= 1));
+						mod.add(IloIfThen(env, y[Index.edge(r, e, sd, 1)] == 1,
+							x[Index.slot(r, slot, e, sd, 1)] >= 1));
 					}
 				}
 			}
@@ -864,442 +2188,277 @@ namespace
 		IloRangeArray con,
 		const IloIntVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const VONETopo::LinkList& Substrate_Network_Edge,
-		const vector<int> Virtual_Networks_Bandwidth)
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
 	{
 		IloEnv env = con.getEnv();
-		string Variable = "Ms_";
-		for (int r = 1; r <= Request_Number; r++)
+		for (int r = Start_Request; r <= Request_Number; r++)
 		{
 			for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
 			{
 				for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
 				{
-					string Variable_Name = Variable + to_string(r) + "_" + to_string(e) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_source._vertex_id) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id);
-					x.add(IloIntVar(env, Variable_Name.c_str()));
-					Variable_Name = Variable + to_string(r) + "_" + to_string(e) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_destination._vertex_id) + "_"
-						+ to_string(Substrate_Network_Edge[sd - 1]._edge_source._vertex_id);
-					x.add(IloIntVar(env, Variable_Name.c_str()));
-
-					con.add(x[2 * (e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] -
-						y[2 * (e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] ==
+					x.add(IloIntVar(env, Table.add(VONEILP::VariableKey('M', r, e, 0, sd, 0))));
+					x.add(IloIntVar(env, Table.add(VONEILP::VariableKey('M', r, e, 0, sd, 1))));
+
+					con.add(x[Index.edge(r, e, sd, 0)] -
+						y[Index.edge(r, e, sd, 0)] ==
 						Virtual_Networks_Bandwidth[r - 1] - 1);
-					con.add(x[(2 * e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] -
-						y[(2 * e - 1)
-						+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-						+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] ==
+					con.add(x[Index.edge(r, e, sd, 1)] -
+						y[Index.edge(r, e, sd, 1)] ==
 						Virtual_Networks_Bandwidth[r - 1] - 1);
 				}
 			}
 		}
 	}
 
+	int addNoOverlap8
+	(IloModel mod,
+		const IloBoolVarArray x,
+		const IloIntVarArray y,
+		const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index)
+	{
+		vector<IfThenNoOverlap> Rows;
+		getNoOverlapRows8(r1, r2, sd, Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth, C, Index, Rows);
+		return addIfThenNoOverlap(mod, x, y, Rows);
+	}
+
 	void constraints8
 	(IloModel mod,
 		const IloBoolVarArray x,
 		const IloIntVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const int C)
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int Thread_Number,
+		const VONEILP::VarIndex& Index)
 	{
-		IloEnv env = mod.getEnv();
-		for (int r1 = 1; r1 <= Request_Number - 1; r1++)
+		vector<long long> Request_Work(Request_Number);
+		for (int r1 = 1; r1 <= Request_Number; r1++)
 		{
-			for (int r2 = r1 + 1; r2 <= Request_Number; r2++)
+			Request_Work[r1 - 1] = Request_Number - max(r1, Start_Request - 1);
+		}
+		vector<pair<int, int> > Chunks;
+		getRequestChunks(Request_Work, Thread_Number, Chunks);
+
+		buildRowsInParallel<vector<IfThenNoOverlap> >(Chunks, Thread_Number,
+			[&](const int First_Request, const int Last_Request, vector<IfThenNoOverlap>& Rows)
 			{
-				int Omega_r1 = Virtual_Networks_Bandwidth[r1 - 1];
-				int Omega_r2 = Virtual_Networks_Bandwidth[r2 - 1];
-				for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+				for (int r1 = First_Request; r1 <= Last_Request; r1++)
 				{
-					for (int c = 1; c <= C; c++)
+					for (int r2 = max(r1 + 1, Start_Request); r2 <= Request_Number; r2++)
 					{
-						IloExpr same_core_con1(env), same_core_con2(env),
-							spectrum_nooverlap_con1(env), spectrum_nooverlap_con2(env);
-
-						same_core_con1 = x[2 * (c - 1)
-							+ (sd - 1) * C * 2
-							+ (r1 - 1) * C * 2 * Substrate_Network_Edge_Number] +
-							x[2 * (c - 1)
-							+ (sd - 1) * C * 2
-							+ (r2 - 1) * C * 2 * Substrate_Network_Edge_Number];
-
-						same_core_con2 = x[(2 * c - 1)
-							+ (sd - 1) * C * 2
-							+ (r1 - 1) * C * 2 * Substrate_Network_Edge_Number] +
-							x[(2 * c - 1)
-							+ (sd - 1) * C * 2
-							+ (r2 - 1) * C * 2 * Substrate_Network_Edge_Number];
-
-						for (int e1 = 1; e1 <= Virtual_Networks_Edge_Number[r1 - 1]; e1++)
+						for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
 						{
-							for (int e2 = 1; e2 <= Virtual_Networks_Edge_Number[r2 - 1]; e2++)
+							if (Candidate_Links[r1 - 1][sd - 1] && Candidate_Links[r2 - 1][sd - 1])
 							{
-								spectrum_nooverlap_con1 = 
-									(y[2 * (e1 - 1)
-									+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number] -
-									y[2 * (e2 - 1)
-									+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number] >= Omega_r2) +
-									(y[2 * (e2 - 1)
-									+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number] -
-									y[2 * (e1 - 1)
-									+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number] >= Omega_r1);
-
-								spectrum_nooverlap_con2 =
-									(y[(2 * e1 - 1)
-									+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number] -
-									y[(2 * e2 - 1)
-									+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number] >= Omega_r2) +
-									(y[(2 * e2 - 1)
-									+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number] -
-									y[(2 * e1 - 1)
-									+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number] >= Omega_r1);
-
-								//Without taking the cross-talk between two adjacent cores into account:
-								mod.add(IloIfThen(env,
-									((same_core_con1 == 2)&&
-									(y[2 * (e1 - 1)
-										+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-										+ Accumulate_Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number] != 0)&&
-									(y[2 * (e2 - 1)
-										+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-										+ Accumulate_Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number] != 0)), 
-									spectrum_nooverlap_con1 == 1));
-
-								mod.add(IloIfThen(env,
-									((same_core_con2 == 2)&&
-									(y[(2 * e1 - 1)
-										+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-										+ Accumulate_Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number] != 0)&&
-									(y[(2 * e2 - 1)
-										+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-										+ Accumulate_Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number] != 0)), 
-									spectrum_nooverlap_con2 == 1));
+								getNoOverlapRows8(r1, r2, sd, Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth, C, Index,
+									Rows);
 							}
 						}
 					}
 				}
-			}
-		}
+			},
+			[&](const vector<IfThenNoOverlap>& Rows)
+			{
+				addIfThenNoOverlap(mod, x, y, Rows);
+			});
 	}
 
-	void constraints9
+	int addNoOverlap9
 	(IloModel mod,
 		const IloBoolVarArray x,
 		const IloIntVarArray y,
-		const int Request_Number,
-		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Bandwidth,
-		const int C)
+		const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index)
 	{
-		IloEnv env = mod.getEnv();
-		for (int r1 = 1; r1 <= Request_Number - 1; r1++)
+		vector<IfThenNoOverlap> Rows;
+		getNoOverlapRows9(r1, r2, sd, Virtual_Networks_Edge_Number, Virtual_Networks_Bandwidth, C, Index, Rows);
+		return addIfThenNoOverlap(mod, x, y, Rows);
+	}
+
+	void constraints9
+	(IloModel mod,
+		const IloBoolVarArray x,
+		const IloIntVarArray y,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int Thread_Number,
+		const VONEILP::VarIndex& Index)
+	{
+		vector<long long> Request_Work(Request_Number);
+		for (int r1 = 1; r1 <= Request_Number; r1++)
 		{
-			for (int r2 = r1 + 1; r2 <= Request_Number; r2++)
+			Request_Work[r1 - 1] = Request_Number - max(r1, Start_Request - 1);
+		}
+		vector<pair<int, int> > Chunks;
+		getRequestChunks(Request_Work, Thread_Number, Chunks);
+
+		buildRowsInParallel<vector<IfThenNoOverlap> >(Chunks, Thread_Number,
+			[&](const int First_Request, const int Last_Request, vector<IfThenNoOverlap>& Rows)
 			{
-				int Omega_r1 = 1;
-				int Omega_r2 = 1;
-				for (int slot1 = 1; slot1 <= Virtual_Networks_Bandwidth[r1 - 1]; slot1++)
+				for (int r1 = First_Request; r1 <= Last_Request; r1++)
 				{
-					for (int slot2 = 1; slot2 <= Virtual_Networks_Bandwidth[r2 - 1]; slot2++)
+					for (int r2 = max(r1 + 1, Start_Request); r2 <= Request_Number; r2++)
 					{
 						for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
 						{
-							for (int e1 = 1; e1 <= Virtual_Networks_Edge_Number[r1 - 1]; e1++)
+							if (Candidate_Links[r1 - 1][sd - 1] && Candidate_Links[r2 - 1][sd - 1])
 							{
-								for (int e2 = 1; e2 <= Virtual_Networks_Edge_Number[r2 - 1]; e2++)
-								{
-									for (int c = 1; c <= C; c++)
-									{
-										IloExpr same_core_con1(env), same_core_con2(env),
-											spectrum_nooverlap_con1(env), spectrum_nooverlap_con2(env);
-
-										same_core_con1 = x[2 * (c - 1)
-											+ (sd - 1) * C * 2
-											+ (r1 - 1) * C * 2 * Substrate_Network_Edge_Number] +
-											x[2 * (c - 1)
-											+ (sd - 1) * C * 2
-											+ (r2 - 1) * C * 2 * Substrate_Network_Edge_Number];
-
-										same_core_con2 = x[(2 * c - 1)
-											+ (sd - 1) * C * 2
-											+ (r1 - 1) * C * 2 * Substrate_Network_Edge_Number] +
-											x[(2 * c - 1)
-											+ (sd - 1) * C * 2
-											+ (r2 - 1) * C * 2 * Substrate_Network_Edge_Number];
-
-										spectrum_nooverlap_con1 = (y[2 * (e1 - 1)
-											+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-											+ (slot1 - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number
-											+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r1 - 1]] -
-											y[2 * (e2 - 1)
-											+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-											+ (slot2 - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number
-											+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r2 - 1]] >= Omega_r2) +
-											(y[2 * (e2 - 1)
-												+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-												+ (slot2 - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number
-												+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r2 - 1]] -
-												y[2 * (e1 - 1)
-												+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-												+ (slot1 - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number
-												+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r1 - 1]] >= Omega_r1);
-										spectrum_nooverlap_con2 = (y[(2 * e1 - 1)
-											+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-											+ (slot1 - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number
-											+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r1 - 1]] -
-											y[(2 * e2 - 1)
-											+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-											+ (slot2 - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number
-											+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r2 - 1]] >= Omega_r2) +
-											(y[(2 * e2 - 1)
-												+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-												+ (slot2 - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number
-												+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r2 - 1]] -
-												y[(2 * e1 - 1)
-												+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-												+ (slot1 - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number
-												+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r1 - 1]] >= Omega_r1);
-
-										mod.add(IloIfThen(env,
-											((same_core_con1 == 2) &&
-											(y[2 * (e1 - 1)
-												+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-												+ (slot1 - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number
-												+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r1 - 1]] != 0) &&
-												(y[2 * (e2 - 1)
-													+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-													+ (slot2 - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number
-													+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r2 - 1]] != 0)),
-											spectrum_nooverlap_con1 == 1));
-
-										mod.add(IloIfThen(env,
-											((same_core_con2 == 2) &&
-											(y[(2 * e1 - 1)
-												+ (sd - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2
-												+ (slot1 - 1) * Virtual_Networks_Edge_Number[r1 - 1] * 2 * Substrate_Network_Edge_Number
-												+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r1 - 1]] != 0) &&
-												(y[(2 * e2 - 1)
-													+ (sd - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2
-													+ (slot2 - 1) * Virtual_Networks_Edge_Number[r2 - 1] * 2 * Substrate_Network_Edge_Number
-													+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r2 - 1]] != 0)),
-											spectrum_nooverlap_con2 == 1));
-									}
-								}
+								getNoOverlapRows9(r1, r2, sd, Virtual_Networks_Edge_Number,
+									Virtual_Networks_Bandwidth, C, Index, Rows);
 							}
 						}
 					}
 				}
-			}
-		}
+			},
+			[&](const vector<IfThenNoOverlap>& Rows)
+			{
+				addIfThenNoOverlap(mod, x, y, Rows);
+			});
 	}
 
-	void constraints10
-	(IloModel mod,
-		const IloIntVarArray x,
-		const IloBoolVarArray y,
+	long long constraints10
+	(IloIntVarArray x,
+		IloRangeArray con,
+		const IloIntVarArray y,
+		const IloBoolVarArray z,
+		const int TypeFlag,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number)
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<vector<bool> >& Candidate_Links,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
 	{
-		IloEnv env = mod.getEnv();
-		for (int r = 1; r <= Request_Number; r++)
+		IloEnv env = con.getEnv();
+		int Max_Bandwidth = 0;
+		for (VONETopo::LinkListIT SNTopoIT = Substrate_Network_Edge.begin(); SNTopoIT != Substrate_Network_Edge.end(); SNTopoIT++)
 		{
-			for (int sd1 = 1; sd1 <= Substrate_Network_Edge_Number; sd1++)
+			Max_Bandwidth = max(Max_Bandwidth, SNTopoIT->_edge_bandwidth);
+		}
+
+		long long Row_Number = 0;
+		for (int r = Start_Request; r <= Request_Number; r++)
+		{
+			//A time slot of TDM has its own offset, and the spectrum of WDM or OFDM has one offset of its start index:
+			int Slot_Number = TypeFlag == 0 ? Virtual_Networks_Bandwidth[r - 1] : 1;
+			int M = TypeFlag == 0 ? Max_Bandwidth : Max_Bandwidth + 1 - Virtual_Networks_Bandwidth[r - 1];
+			for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
 			{
-				for (int sd2 = 1; sd2 <= Substrate_Network_Edge_Number; sd2++)
+				IloInt First_Offset = x.getSize();
+				for (int slot = 1; slot <= Slot_Number; slot++)
 				{
-					for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
+					x.add(IloIntVar(env, 1, M, Table.add(VONEILP::VariableKey('g', r, slot, e, 0, 0))));
+					IloIntVar Offset = x[First_Offset + slot - 1];
+					if (slot > 1)
 					{
-						if (sd1 != sd2)
+						con.add(Offset - x[First_Offset + slot - 2] >= 1);
+						Row_Number++;
+					}
+
+					//The index of an unused link is 0, so it is at most the offset, and the offset is at most M:
+					for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+					{
+						if (!Candidate_Links[r - 1][sd - 1])
 						{
-							mod.add(IloIfThen(env, y[2 * (e - 1)
-								+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] +
-								y[2 * (e - 1)
-								+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 2,
-								x[2 * (e - 1)
-								+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] -
-								x[2 * (e - 1)
-								+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 0));
-
-							mod.add(IloIfThen(env, y[2 * (e - 1)
-								+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] +
-								y[(2 * e - 1)
-								+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 2,
-								x[2 * (e - 1)
-								+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] -
-								x[(2 * e - 1)
-								+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 0));
-
-							mod.add(IloIfThen(env, y[(2 * e - 1)
-								+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] +
-								y[2 * (e - 1)
-								+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 2,
-								x[(2 * e - 1)
-								+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] -
-								x[2 * (e - 1)
-								+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 0));
-
-							mod.add(IloIfThen(env, y[(2 * e - 1)
-								+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] +
-								y[(2 * e - 1)
-								+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 2,
-								x[(2 * e - 1)
-								+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] -
-								x[(2 * e - 1)
-								+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-								+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 0));
+							continue;
+						}
+						for (int d = 0; d <= 1; d++)
+						{
+							int Position = TypeFlag == 0 ? Index.slot(r, slot, e, sd, d) : Index.edge(r, e, sd, d);
+							con.add(y[Position] - Offset <= 0);
+							con.add(Offset - y[Position] + M * z[Index.edge(r, e, sd, d)] <= M);
+							Row_Number += 2;
 						}
 					}
 				}
 			}
 		}
+
+		return Row_Number;
 	}
 
-	void constraints11
+	long long constraints11
 	(IloModel mod,
 		const IloIntVarArray x,
 		const IloBoolVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Bandwidth)
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int Thread_Number,
+		const VONEILP::VarIndex& Index)
 	{
-		IloEnv env = mod.getEnv();
+		vector<long long> Request_Work(Request_Number);
 		for (int r = 1; r <= Request_Number; r++)
 		{
-			for (int slot = 1; slot <= Virtual_Networks_Bandwidth[r - 1]; slot++)
+			Request_Work[r - 1] = r < Start_Request ? 0 : 
+				static_cast<long long>(Virtual_Networks_Bandwidth[r - 1]) * Virtual_Networks_Edge_Number[r - 1];
+		}
+		vector<pair<int, int> > Chunks;
+		getRequestChunks(Request_Work, Thread_Number, Chunks);
+
+		long long Row_Number = 0;
+		buildRowsInParallel<vector<IfThenConsistency> >(Chunks, Thread_Number,
+			[&](const int First_Request, const int Last_Request, vector<IfThenConsistency>& Rows)
 			{
-				for (int sd1 = 1; sd1 <= Substrate_Network_Edge_Number; sd1++)
+				for (int r = max(First_Request, Start_Request); r <= Last_Request; r++)
 				{
-					for (int sd2 = 1; sd2 <= Substrate_Network_Edge_Number; sd2++)
-					{
-						for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
-						{
-							if (sd1 != sd2)
-							{
-								mod.add(IloIfThen(env, y[2 * (e - 1)
-									+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] +
-									y[2 * (e - 1)
-									+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 2,
-									x[2 * (e - 1)
-									+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-									+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] -
-									x[2 * (e - 1)
-									+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-									+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] == 0));
-
-								mod.add(IloIfThen(env, y[2 * (e - 1)
-									+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] +
-									y[(2 * e - 1)
-									+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 2,
-									x[2 * (e - 1)
-									+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-									+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] -
-									x[(2 * e - 1)
-									+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-									+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] == 0));
-
-								mod.add(IloIfThen(env, y[(2 * e - 1)
-									+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] +
-									y[2 * (e - 1)
-									+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 2,
-									x[(2 * e - 1)
-									+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-									+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] -
-									x[2 * (e - 1)
-									+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-									+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] == 0));
-
-								mod.add(IloIfThen(env, y[(2 * e - 1)
-									+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] +
-									y[(2 * e - 1)
-									+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 2,
-									x[(2 * e - 1)
-									+ (sd1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-									+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] -
-									x[(2 * e - 1)
-									+ (sd2 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-									+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-									+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] == 0));
-							}
-						}
-					}
+					getConsistencyRows11(r, Substrate_Network_Edge_Number, Virtual_Networks_Edge_Number,
+						Virtual_Networks_Bandwidth, Index, Rows);
 				}
-			}
-		}
+			},
+			[&](const vector<IfThenConsistency>& Rows)
+			{
+				Row_Number += addIfThenConsistency(mod, x, y, Rows);
+			});
+
+		return Row_Number;
 	}
 
-	void constraints12
+	long long constraints12
 	(IloModel mod,
 		const IloIntVarArray x,
 		const IloBoolVarArray y,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Edge_Number,
-		const vector<int> Accumulate_Virtual_Networks_Edge_Number,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Bandwidth)
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const VONEILP::VarIndex& Index)
 	{
 		IloEnv env = mod.getEnv();
-		for (int r = 1; r <= Request_Number; r++)
+		long long Row_Number = 0;
+		for (int r = Start_Request; r <= Request_Number; r++)
 		{
 			for (int slot = 1; slot <= Virtual_Networks_Bandwidth[r - 1] - 1; slot++)
 			{
@@ -1307,160 +2466,1721 @@ namespace
 				{
 					for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
 					{
-						mod.add(IloIfThen(env, y[2 * (e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 1, 
-							x[2 * (e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ (slot + 1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-							+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] - 
-							x[2 * (e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-							+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] >= 1));
-						mod.add(IloIfThen(env, y[(2 * e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number] == 1,
-							x[(2 * e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ (slot + 1 - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-							+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] - 
-							x[(2 * e - 1)
-							+ (sd - 1) * Virtual_Networks_Edge_Number[r - 1] * 2
-							+ (slot - 1) * Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number
-							+ 2 * Substrate_Network_Edge_Number * Accumulate_Virtual_Networks_Bandwidth[r - 1]] >= 1));
+						mod.add(IloIfThen(env, y[Index.edge(r, e, sd, 0)] == 1, 
+							x[Index.slot(r, slot + 1, e, sd, 0)] - 
+							x[Index.slot(r, slot, e, sd, 0)] >= 1));
+						mod.add(IloIfThen(env, y[Index.edge(r, e, sd, 1)] == 1,
+							x[Index.slot(r, slot + 1, e, sd, 1)] - 
+							x[Index.slot(r, slot, e, sd, 1)] >= 1));
+						Row_Number += 2;
 					}
 				}
 			}
 		}
+
+		return Row_Number;
 	}
 
 	void constraints13
 	(IloIntVarArray x,
 		IloRangeArray con,
 		const int Request_Number,
-		const int Min_Substrate_Network_Bandwidth,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Bandwidth)
+		const int Start_Request,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table)
 	{
 		IloEnv env = con.getEnv();
-		string Variable = "f_";
-		for (int r = 1; r <= Request_Number; r++)
+		int Max_Bandwidth = 0;
+		for (VONETopo::LinkListIT SNTopoIT = Substrate_Network_Edge.begin(); SNTopoIT != Substrate_Network_Edge.end(); SNTopoIT++)
 		{
-			string Variable_Name = Variable + to_string(r) + "_1";
-			x.add(IloIntVar(env, 0, Min_Substrate_Network_Bandwidth, Variable_Name.c_str()));
-			for (int slot = 2; slot <= Virtual_Networks_Bandwidth[r - 1]; slot++)
-			{
-				string Variable_Name = Variable + to_string(r) + "_" + to_string(slot);
-				x.add(IloIntVar(env, 0, Min_Substrate_Network_Bandwidth, Variable_Name.c_str()));
+			Max_Bandwidth = max(Max_Bandwidth, SNTopoIT->_edge_bandwidth);
+		}
 
-				con.add(x[(slot - 1) + Accumulate_Virtual_Networks_Bandwidth[r - 1]] -
-					x[(slot - 2) + Accumulate_Virtual_Networks_Bandwidth[r - 1]] >= 1);
+		//Every request is embedded, so its time slots are in [1, the largest bandwidth]:
+		for (int r = Start_Request; r <= Request_Number; r++)
+		{
+			IloInt First_Slot = x.getSize();
+			for (int slot = 1; slot <= Virtual_Networks_Bandwidth[r - 1]; slot++)
+			{
+				x.add(IloIntVar(env, 1, Max_Bandwidth, Table.add(VONEILP::VariableKey('T', r, slot, 0, 0, 0))));
+				if (slot > 1)
+				{
+					con.add(x[First_Slot + slot - 1] - x[First_Slot + slot - 2] >= 1);
+				}
 			}
 		}
 	}
 
 	void constraints14
-	(IloModel mod, 
-		const IloIntVarArray x,	
+	(IloRangeArray con,
+		const IloIntVarArray x,
 		const IloBoolVarArray y,
 		const int Request_Number,
-		const int Substrate_Network_Vertex_Number,
-		const vector<int> Virtual_Networks_Vertex_Number,
-		const vector<int> Accumulate_Virtual_Networks_Vertex_Number,
-		const vector<vector<int> > Computing_Capacity_in_Virtual_Vertexes,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Bandwidth)
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const vector<vector<bool> >& Candidate_Links,
+		const VONEILP::VarIndex& Index)
 	{
-		IloEnv env = mod.getEnv();
-		for (int r = 1; r <= Request_Number; r++)
+		int Max_Bandwidth = 0;
+		for (VONETopo::LinkListIT SNTopoIT = Substrate_Network_Edge.begin(); SNTopoIT != Substrate_Network_Edge.end(); SNTopoIT++)
 		{
-			for (int slot = 1; slot <= Virtual_Networks_Bandwidth[r - 1]; slot++)
+			Max_Bandwidth = max(Max_Bandwidth, SNTopoIT->_edge_bandwidth);
+		}
+
+		for (int r = Start_Request; r <= Request_Number; r++)
+		{
+			int Last_Slot = (Virtual_Networks_Bandwidth[r - 1] - 1) + Accumulate_Virtual_Networks_Bandwidth[r - 1];
+			for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+			{
+				int Link_Bandwidth = Substrate_Network_Edge[sd - 1]._edge_bandwidth;
+				if (!Candidate_Links[r - 1][sd - 1] || (Link_Bandwidth >= Max_Bandwidth))
+				{
+					continue;
+				}
+
+				for (int d = 0; d <= 1; d++)
+				{
+					con.add(x[Last_Slot] + (Max_Bandwidth - Link_Bandwidth) * y[Index.edge(r, 1, sd, d)] <= Max_Bandwidth);
+				}
+			}
+		}
+	}
+
+	void getNoOverlapRows15
+	(const int r1,
+		const int r2,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int M,
+		const int NoOverlap_Flag,
+		const VONEILP::VarIndex& Index,
+		vector<IfThenNoOverlap>& Logical_Rows,
+		BigMNoOverlapBuffer& BigM_Rows)
+	{
+		bool Shared_Link = false;
+		for (int sd = 1; (sd <= Substrate_Network_Edge_Number) && !Shared_Link; sd++)
+		{
+			Shared_Link = Candidate_Links[r1 - 1][sd - 1] && Candidate_Links[r2 - 1][sd - 1];
+		}
+		if (!Shared_Link)
+		{
+			return;
+		}
+
+		for (int slot1 = 1; slot1 <= Virtual_Networks_Bandwidth[r1 - 1]; slot1++)
+		{
+			for (int slot2 = 1; slot2 <= Virtual_Networks_Bandwidth[r2 - 1]; slot2++)
 			{
-				for (int v = 1; v <= Virtual_Networks_Vertex_Number[r - 1]; v++)
+				if (NoOverlap_Flag == 1)
+				{
+					BigM_Rows._order_key.push_back(VONEILP::VariableKey('P', r1, r2,
+						(slot1 - 1) * Virtual_Networks_Bandwidth[r2 - 1] + (slot2 - 1), 0, 0));
+				}
+
+				for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
 				{
-					mod.add(IloIfThen(env, y[(Computing_Capacity_in_Virtual_Vertexes[r - 1][v - 1] - 1)
-						+ (v - 1) * Substrate_Network_Vertex_Number
-						+ Substrate_Network_Vertex_Number * Accumulate_Virtual_Networks_Vertex_Number[r - 1]] + 
-						y[(Computing_Capacity_in_Virtual_Vertexes[r - 1][v - 1] - 1)
-						+ (v - 1) * Substrate_Network_Vertex_Number
-						+ Substrate_Network_Vertex_Number * Accumulate_Virtual_Networks_Vertex_Number[r - 1]] == 0,
-						x[(slot - 1) + Accumulate_Virtual_Networks_Bandwidth[r - 1]] == 0));
-					mod.add(IloIfThen(env, y[(Computing_Capacity_in_Virtual_Vertexes[r - 1][v - 1] - 1)
-						+ (v - 1) * Substrate_Network_Vertex_Number
-						+ Substrate_Network_Vertex_Number * Accumulate_Virtual_Networks_Vertex_Number[r - 1]] + 
-						y[(Computing_Capacity_in_Virtual_Vertexes[r - 1][v - 1] - 1)
-						+ (v - 1) * Substrate_Network_Vertex_Number
-						+ Substrate_Network_Vertex_Number * Accumulate_Virtual_Networks_Vertex_Number[r - 1]] == 2,
-							x[(slot - 1) + Accumulate_Virtual_Networks_Bandwidth[r - 1]] >= 1));
+					if (!Candidate_Links[r1 - 1][sd - 1] || !Candidate_Links[r2 - 1][sd - 1])
+					{
+						continue;
+					}
+
+					for (int d = 0; d <= 1; d++)
+					{
+						for (int c = 1; c <= C; c++)
+						{
+							int Core_r1 = Index.core(r1, c, sd, d);
+							int Core_r2 = Index.core(r2, c, sd, d);
+							int Index_r1 = (slot1 - 1) + Accumulate_Virtual_Networks_Bandwidth[r1 - 1];
+							int Index_r2 = (slot2 - 1) + Accumulate_Virtual_Networks_Bandwidth[r2 - 1];
+							if (NoOverlap_Flag == 0)
+							{
+								IfThenNoOverlap Row;
+								Row._core_r1 = Core_r1;
+								Row._core_r2 = Core_r2;
+								Row._index_r1 = Index_r1;
+								Row._index_r2 = Index_r2;
+								Row._omega_r1 = 1;
+								Row._omega_r2 = 1;
+								Logical_Rows.push_back(Row);
+								continue;
+							}
+
+							//The time slots are in [1, M] and the core variables are 1 only on the used links, so M separates
+							//    them and no link is released:
+							BigMNoOverlap Row;
+							Row._order = static_cast<int>(BigM_Rows._order_key.size()) - 1;
+							Row._core_r1 = Core_r1;
+							Row._core_r2 = Core_r2;
+							Row._link_r1 = -1;
+							Row._link_r2 = -1;
+							Row._index_r1 = Index_r1;
+							Row._index_r2 = Index_r2;
+							Row._m_order = M;
+							Row._m_core = M;
+							Row._omega_r1 = 1;
+							Row._omega_r2 = 1;
+							BigM_Rows._row.push_back(Row);
+						}
+					}
 				}
 			}
-		}			
+		}
 	}
 
 	void constraints15
-	(IloModel mod,
-		const IloBoolVarArray x,
-		const IloIntVarArray y,
+	(IloBoolVarArray x,
+		IloModel mod,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloIntVarArray z,
 		const int Request_Number,
+		const int Start_Request,
 		const int Substrate_Network_Edge_Number,
-		const vector<int> Virtual_Networks_Bandwidth,
-		const vector<int> Accumulate_Virtual_Networks_Bandwidth,
-		const int C)
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int NoOverlap_Flag,
+		const int Thread_Number,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
 	{
-		IloEnv env = mod.getEnv();
-		for (int r1 = 1; r1 <= Request_Number - 1; r1++)
+		int M = 0;
+		for (VONETopo::LinkListIT SNTopoIT = Substrate_Network_Edge.begin(); SNTopoIT != Substrate_Network_Edge.end(); SNTopoIT++)
+		{
+			M = max(M, SNTopoIT->_edge_bandwidth);
+		}
+
+		vector<long long> Request_Work(Request_Number);
+		for (int r1 = 1; r1 <= Request_Number; r1++)
 		{
-			for (int r2 = r1 + 1; r2 <= Request_Number; r2++)
+			Request_Work[r1 - 1] = Request_Number - max(r1, Start_Request - 1);
+		}
+		vector<pair<int, int> > Chunks;
+		getRequestChunks(Request_Work, Thread_Number, Chunks);
+
+		//Only the rows of NoOverlap_Flag are generated into the buffer:
+		typedef pair<vector<IfThenNoOverlap>, BigMNoOverlapBuffer> NoOverlapBuffer15;
+		buildRowsInParallel<NoOverlapBuffer15>(Chunks, Thread_Number,
+			[&](const int First_Request, const int Last_Request, NoOverlapBuffer15& Rows)
 			{
-				int Omega_r1 = 1;
-				int Omega_r2 = 1;
-				for (int slot1 = 1; slot1 <= Virtual_Networks_Bandwidth[r1 - 1]; slot1++)
+				for (int r1 = First_Request; r1 <= Last_Request; r1++)
 				{
-					for (int slot2 = 1; slot2 <= Virtual_Networks_Bandwidth[r2 - 1]; slot2++)
+					for (int r2 = max(r1 + 1, Start_Request); r2 <= Request_Number; r2++)
+					{
+						getNoOverlapRows15(r1, r2, Substrate_Network_Edge_Number, Virtual_Networks_Bandwidth,
+							Accumulate_Virtual_Networks_Bandwidth, C, Candidate_Links, M, NoOverlap_Flag, Index, Rows.first, Rows.second);
+					}
+				}
+			},
+			[&](const NoOverlapBuffer15& Rows)
+			{
+				if (NoOverlap_Flag == 1)
+				{
+					addBigMNoOverlap(x, con, y, IloBoolVarArray(), z, Rows.second, Table);
+				}
+				else
+				{
+					addIfThenNoOverlap(mod, y, z, Rows.first);
+				}
+			});
+	}
+
+	int getSlotPosition
+	(const int r,
+		const int slot,
+		const int e,
+		const int sd,
+		const int Direction,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int Slot_Flag,
+		const VONEILP::VarIndex& Index)
+	{
+		return Slot_Flag == 1 ? (slot - 1) + Accumulate_Virtual_Networks_Bandwidth[r - 1] : Index.slot(r, slot, e, sd, Direction);
+	}
+
+	int addNoOverlap16
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloBoolVarArray l,
+		const IloIntVarArray z,
+		const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
+	{
+		BigMNoOverlapBuffer Rows;
+		getNoOverlapRows16(r1, r2, sd, Virtual_Networks_Edge_Number, Substrate_Network_Edge, Virtual_Networks_Bandwidth, C, Index,
+			Rows);
+		return addBigMNoOverlap(x, con, y, l, z, Rows, Table);
+	}
+
+	void constraints16
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloBoolVarArray l,
+		const IloIntVarArray z,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int Thread_Number,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
+	{
+		vector<long long> Request_Work(Request_Number);
+		for (int r1 = 1; r1 <= Request_Number; r1++)
+		{
+			Request_Work[r1 - 1] = Request_Number - max(r1, Start_Request - 1);
+		}
+		vector<pair<int, int> > Chunks;
+		getRequestChunks(Request_Work, Thread_Number, Chunks);
+
+		buildRowsInParallel<BigMNoOverlapBuffer>(Chunks, Thread_Number,
+			[&](const int First_Request, const int Last_Request, BigMNoOverlapBuffer& Rows)
+			{
+				for (int r1 = First_Request; r1 <= Last_Request; r1++)
+				{
+					for (int r2 = max(r1 + 1, Start_Request); r2 <= Request_Number; r2++)
 					{
 						for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
 						{
-							for (int c = 1; c <= C; c++)
+							if (Candidate_Links[r1 - 1][sd - 1] && Candidate_Links[r2 - 1][sd - 1])
+							{
+								getNoOverlapRows16(r1, r2, sd, Virtual_Networks_Edge_Number, Substrate_Network_Edge,
+									Virtual_Networks_Bandwidth, C, Index, Rows);
+							}
+						}
+					}
+				}
+			},
+			[&](const BigMNoOverlapBuffer& Rows)
+			{
+				addBigMNoOverlap(x, con, y, l, z, Rows, Table);
+			});
+	}
+
+	int addNoOverlap17
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloBoolVarArray l,
+		const IloIntVarArray z,
+		const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
+	{
+		BigMNoOverlapBuffer Rows;
+		getNoOverlapRows17(r1, r2, sd, Virtual_Networks_Edge_Number, Substrate_Network_Edge, Virtual_Networks_Bandwidth, C, Index,
+			Rows);
+		return addBigMNoOverlap(x, con, y, l, z, Rows, Table);
+	}
+
+	void constraints17
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloBoolVarArray l,
+		const IloIntVarArray z,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const int Thread_Number,
+		VONEILP::VariableTable& Table,
+		const VONEILP::VarIndex& Index)
+	{
+		vector<long long> Request_Work(Request_Number);
+		for (int r1 = 1; r1 <= Request_Number; r1++)
+		{
+			Request_Work[r1 - 1] = Request_Number - max(r1, Start_Request - 1);
+		}
+		vector<pair<int, int> > Chunks;
+		getRequestChunks(Request_Work, Thread_Number, Chunks);
+
+		buildRowsInParallel<BigMNoOverlapBuffer>(Chunks, Thread_Number,
+			[&](const int First_Request, const int Last_Request, BigMNoOverlapBuffer& Rows)
+			{
+				for (int r1 = First_Request; r1 <= Last_Request; r1++)
+				{
+					for (int r2 = max(r1 + 1, Start_Request); r2 <= Request_Number; r2++)
+					{
+						for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+						{
+							if (Candidate_Links[r1 - 1][sd - 1] && Candidate_Links[r2 - 1][sd - 1])
 							{
-								IloExpr same_core_con1(env), same_core_con2(env),
-									spectrum_nooverlap_con(env);
-
-								same_core_con1 = x[2 * (c - 1)
-									+ (sd - 1) * C * 2
-									+ (r1 - 1) * C * 2 * Substrate_Network_Edge_Number] +
-									x[2 * (c - 1)
-									+ (sd - 1) * C * 2
-									+ (r2 - 1) * C * 2 * Substrate_Network_Edge_Number];
-
-								same_core_con2 = x[(2 * c - 1)
-									+ (sd - 1) * C * 2
-									+ (r1 - 1) * C * 2 * Substrate_Network_Edge_Number] +
-									x[(2 * c - 1)
-									+ (sd - 1) * C * 2
-									+ (r2 - 1) * C * 2 * Substrate_Network_Edge_Number];
-
-								spectrum_nooverlap_con = (y[(slot1 - 1) + Accumulate_Virtual_Networks_Bandwidth[r1 - 1]] -
-											y[(slot2 - 1) + Accumulate_Virtual_Networks_Bandwidth[r2 - 1]] >= Omega_r2) +
-											(y[(slot2 - 1) + Accumulate_Virtual_Networks_Bandwidth[r2 - 1]] -
-											y[(slot1 - 1) + Accumulate_Virtual_Networks_Bandwidth[r1 - 1]] >= Omega_r1);
-
-								mod.add(IloIfThen(env,
-									((same_core_con1 == 2) &&
-									(y[(slot1 - 1) + Accumulate_Virtual_Networks_Bandwidth[r1 - 1]] != 0) &&
-									(y[(slot2 - 1) + Accumulate_Virtual_Networks_Bandwidth[r2 - 1]] != 0)),
-									spectrum_nooverlap_con == 1));
-
-								mod.add(IloIfThen(env,
-									((same_core_con2 == 2) &&
-									(y[(slot1 - 1) + Accumulate_Virtual_Networks_Bandwidth[r1 - 1]] != 0) &&
-									(y[(slot2 - 1) + Accumulate_Virtual_Networks_Bandwidth[r2 - 1]] != 0)),
-									spectrum_nooverlap_con == 1));
+								getNoOverlapRows17(r1, r2, sd, Virtual_Networks_Edge_Number, Substrate_Network_Edge,
+									Virtual_Networks_Bandwidth, C, Index, Rows);
 							}
 						}
 					}
 				}
+			},
+			[&](const BigMNoOverlapBuffer& Rows)
+			{
+				addBigMNoOverlap(x, con, y, l, z, Rows, Table);
+			});
+	}
+
+	void getCandidatePaths
+	(const VONEPath::PathCache& Paths,
+		const vector<VONETopo::LinkList>& Virtual_Networks_Edge,
+		const vector<vector<int> >& Computing_Capacity_in_Virtual_Vertexes,
+		vector<VONEPath::PathList>& Candidate_Paths,
+		vector<int>& Accumulate_Candidate_Path_Number)
+	{
+		int Request_Number = static_cast<int>(Virtual_Networks_Edge.size());
+		Candidate_Paths.resize(Request_Number);
+		Accumulate_Candidate_Path_Number.resize(Request_Number);
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			int Source = Computing_Capacity_in_Virtual_Vertexes[r - 1][Virtual_Networks_Edge[r - 1][0]._edge_source._vertex_id - 1];
+			int Destination = Computing_Capacity_in_Virtual_Vertexes[r - 1][Virtual_Networks_Edge[r - 1][0]._edge_destination._vertex_id - 1];
+			Candidate_Paths[r - 1] = Paths.get_paths(Source, Destination);
+			Accumulate_Candidate_Path_Number[r - 1] = (r == 1) ? 0 : 
+				Accumulate_Candidate_Path_Number[r - 2] + static_cast<int>(Candidate_Paths[r - 2].size());
+		}
+	}
+
+	bool less_path_pair(const PathPair& FirstPathPair, const PathPair& SecondPathPair)
+	{
+		if (FirstPathPair._r1 != SecondPathPair._r1)
+		{
+			return FirstPathPair._r1 < SecondPathPair._r1;
+		}
+		if (FirstPathPair._r2 != SecondPathPair._r2)
+		{
+			return FirstPathPair._r2 < SecondPathPair._r2;
+		}
+		if (FirstPathPair._k1 != SecondPathPair._k1)
+		{
+			return FirstPathPair._k1 < SecondPathPair._k1;
+		}
+		return FirstPathPair._k2 < SecondPathPair._k2;
+	}
+
+	void getSharedPathPairs
+	(const vector<VONEPath::PathList>& Candidate_Paths,
+		const int Substrate_Network_Edge_Number,
+		vector<PathPair>& Path_Pairs)
+	{
+		//The request and the number of each candidate path on the link sd in the direction d are at 2 * (sd - 1) + d, in the order of
+		//    the requests, and the candidate paths of the request r are numbered from First_Path[r - 1]:
+		vector<vector<pair<int, int> > > Arc_Paths(2 * static_cast<size_t>(Substrate_Network_Edge_Number));
+		vector<int> First_Path(Candidate_Paths.size() + 1, 0);
+		for (int r = 1; r <= static_cast<int>(Candidate_Paths.size()); r++)
+		{
+			for (int k = 1; k <= static_cast<int>(Candidate_Paths[r - 1].size()); k++)
+			{
+				const VONEPath::Path& Route = Candidate_Paths[r - 1][k - 1];
+				for (size_t i = 0; i < Route._link.size(); i++)
+				{
+					Arc_Paths[2 * (Route._link[i] - 1) + Route._direction[i]].push_back(make_pair(r, k));
+				}
+			}
+			First_Path[r] = First_Path[r - 1] + static_cast<int>(Candidate_Paths[r - 1].size());
+		}
+
+		//The paths of the later requests on the links of the path k1 of r1, each found once by marking it with the number of k1:
+		Path_Pairs.clear();
+		vector<int> Marked_By(First_Path.back(), -1);
+		for (int r1 = 1; r1 <= static_cast<int>(Candidate_Paths.size()); r1++)
+		{
+			size_t First_Pair = Path_Pairs.size();
+			for (int k1 = 1; k1 <= static_cast<int>(Candidate_Paths[r1 - 1].size()); k1++)
+			{
+				const VONEPath::Path& Route = Candidate_Paths[r1 - 1][k1 - 1];
+				int Mark = First_Path[r1 - 1] + k1 - 1;
+				for (size_t i = 0; i < Route._link.size(); i++)
+				{
+					const vector<pair<int, int> >& Paths = Arc_Paths[2 * (Route._link[i] - 1) + Route._direction[i]];
+					vector<pair<int, int> >::const_iterator PathIT = upper_bound(Paths.begin(), Paths.end(), make_pair(r1, INT_MAX));
+					for (; PathIT != Paths.end(); PathIT++)
+					{
+						int& Path_Mark = Marked_By[First_Path[PathIT->first - 1] + PathIT->second - 1];
+						if (Path_Mark != Mark)
+						{
+							Path_Mark = Mark;
+							PathPair Pair = { r1, PathIT->first, k1, PathIT->second };
+							Path_Pairs.push_back(Pair);
+						}
+					}
+				}
+			}
+			sort(Path_Pairs.begin() + First_Pair, Path_Pairs.end(), less_path_pair);
+		}
+	}
+
+	void constraints18
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const int Request_Number,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		VONEILP::VariableTable& Table)
+	{
+		IloEnv env = con.getEnv();
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			IloExpr con18(env);
+			for (int k = 1; k <= static_cast<int>(Candidate_Paths[r - 1].size()); k++)
+			{
+				x.add(IloBoolVar(env, Table.add(VONEILP::VariableKey('p', r, k, 0, 0, 0))));
+				con18 += x[(k - 1) + Accumulate_Candidate_Path_Number[r - 1]];
+			}
+			con.add(con18 == 1);
+		}
+	}
+
+	void constraints19
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const int Request_Number,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const int C,
+		VONEILP::VariableTable& Table)
+	{
+		IloEnv env = con.getEnv();
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			for (int k = 1; k <= static_cast<int>(Candidate_Paths[r - 1].size()); k++)
+			{
+				IloExpr con19(env);
+				for (int c = 1; c <= C; c++)
+				{
+					x.add(IloBoolVar(env, Table.add(VONEILP::VariableKey('C', r, k, c, 0, 0))));
+					con19 += x[(c - 1) + (k - 1) * C + Accumulate_Candidate_Path_Number[r - 1] * C];
+				}
+				con.add(con19 - y[(k - 1) + Accumulate_Candidate_Path_Number[r - 1]] == 0);
 			}
 		}
 	}
-}
\ No newline at end of file
+
+	void constraints20
+	(IloIntVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const int Request_Number,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table)
+	{
+		IloEnv env = con.getEnv();
+		int Max_Bandwidth = 0;
+		for (VONETopo::LinkListIT SNTopoIT = Substrate_Network_Edge.begin(); SNTopoIT != Substrate_Network_Edge.end(); SNTopoIT++)
+		{
+			Max_Bandwidth = max(Max_Bandwidth, SNTopoIT->_edge_bandwidth);
+		}
+
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			x.add(IloIntVar(env, 1, Max_Bandwidth + 1 - Virtual_Networks_Bandwidth[r - 1],
+				Table.add(VONEILP::VariableKey('F', r, 0, 0, 0, 0))));
+			for (int k = 1; k <= static_cast<int>(Candidate_Paths[r - 1].size()); k++)
+			{
+				int Path_Bandwidth = Max_Bandwidth;
+				for (vector<int>::const_iterator LinkIT = Candidate_Paths[r - 1][k - 1]._link.begin();
+					LinkIT != Candidate_Paths[r - 1][k - 1]._link.end(); LinkIT++)
+				{
+					Path_Bandwidth = min(Path_Bandwidth, Substrate_Network_Edge[*LinkIT - 1]._edge_bandwidth);
+				}
+
+				if (Path_Bandwidth < Max_Bandwidth)
+				{
+					con.add(x[r - 1] + (Max_Bandwidth - Path_Bandwidth) * y[(k - 1) + Accumulate_Candidate_Path_Number[r - 1]]
+						<= Max_Bandwidth + 1 - Virtual_Networks_Bandwidth[r - 1]);
+				}
+			}
+		}
+	}
+
+	void constraints21
+	(IloIntVarArray x,
+		IloRangeArray con,
+		const IloIntVarArray y,
+		const int Request_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table)
+	{
+		IloEnv env = con.getEnv();
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			x.add(IloIntVar(env, Table.add(VONEILP::VariableKey('S', r, 0, 0, 0, 0))));
+			con.add(x[r - 1] - y[r - 1] == Virtual_Networks_Bandwidth[r - 1] - 1);
+		}
+	}
+
+	void constraints22
+	(IloIntVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const int Request_Number,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		VONEILP::VariableTable& Table)
+	{
+		IloEnv env = con.getEnv();
+		int Max_Bandwidth = 0;
+		for (VONETopo::LinkListIT SNTopoIT = Substrate_Network_Edge.begin(); SNTopoIT != Substrate_Network_Edge.end(); SNTopoIT++)
+		{
+			Max_Bandwidth = max(Max_Bandwidth, SNTopoIT->_edge_bandwidth);
+		}
+
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			for (int slot = 1; slot <= Virtual_Networks_Bandwidth[r - 1]; slot++)
+			{
+				x.add(IloIntVar(env, 1, Max_Bandwidth, Table.add(VONEILP::VariableKey('T', r, slot, 0, 0, 0))));
+				if (slot > 1)
+				{
+					con.add(x[(slot - 1) + Accumulate_Virtual_Networks_Bandwidth[r - 1]] -
+						x[(slot - 2) + Accumulate_Virtual_Networks_Bandwidth[r - 1]] >= 1);
+				}
+			}
+
+			for (int k = 1; k <= static_cast<int>(Candidate_Paths[r - 1].size()); k++)
+			{
+				int Path_Bandwidth = Max_Bandwidth;
+				for (vector<int>::const_iterator LinkIT = Candidate_Paths[r - 1][k - 1]._link.begin();
+					LinkIT != Candidate_Paths[r - 1][k - 1]._link.end(); LinkIT++)
+				{
+					Path_Bandwidth = min(Path_Bandwidth, Substrate_Network_Edge[*LinkIT - 1]._edge_bandwidth);
+				}
+
+				if (Path_Bandwidth < Max_Bandwidth)
+				{
+					con.add(x[(Virtual_Networks_Bandwidth[r - 1] - 1) + Accumulate_Virtual_Networks_Bandwidth[r - 1]]
+						+ (Max_Bandwidth - Path_Bandwidth) * y[(k - 1) + Accumulate_Candidate_Path_Number[r - 1]] <= Max_Bandwidth);
+				}
+			}
+		}
+	}
+
+	void constraints23
+	(IloBoolVarArray x,
+		IloModel mod,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloIntVarArray z,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const int NoOverlap_Flag,
+		VONEILP::VariableTable& Table)
+	{
+		IloEnv env = con.getEnv();
+		//Every request is embedded, so a start index is in [1, Bandwidth + 1 - Omega] and the largest bandwidth is a valid big-M:
+		int M = 0;
+		for (VONETopo::LinkListIT SNTopoIT = Substrate_Network_Edge.begin(); SNTopoIT != Substrate_Network_Edge.end(); SNTopoIT++)
+		{
+			M = max(M, SNTopoIT->_edge_bandwidth);
+		}
+
+		vector<PathPair> Path_Pairs;
+		getSharedPathPairs(Candidate_Paths, static_cast<int>(Substrate_Network_Edge.size()), Path_Pairs);
+		//The start index belongs to the request, so one order variable serves all the path pairs and cores of two requests, which
+		//    are next to each other in Path_Pairs:
+		IloBoolVar Order;
+		for (vector<PathPair>::const_iterator PairIT = Path_Pairs.begin(); PairIT != Path_Pairs.end(); PairIT++)
+		{
+			int r1 = PairIT->_r1;
+			int r2 = PairIT->_r2;
+			int Omega_r1 = Virtual_Networks_Bandwidth[r1 - 1];
+			int Omega_r2 = Virtual_Networks_Bandwidth[r2 - 1];
+			if ((NoOverlap_Flag == 1) && ((PairIT == Path_Pairs.begin()) || ((PairIT - 1)->_r1 != r1) || ((PairIT - 1)->_r2 != r2)))
+			{
+				x.add(IloBoolVar(env, Table.add(VONEILP::VariableKey('Q', r1, r2, 0, 0, 0))));
+				Order = x[x.getSize() - 1];
+			}
+
+			for (int c = 1; c <= C; c++)
+			{
+				int Core_r1 = (c - 1) + (PairIT->_k1 - 1) * C + Accumulate_Candidate_Path_Number[r1 - 1] * C;
+				int Core_r2 = (c - 1) + (PairIT->_k2 - 1) * C + Accumulate_Candidate_Path_Number[r2 - 1] * C;
+				if (NoOverlap_Flag == 1)
+				{
+					con.add(z[r1 - 1] - z[r2 - 1] + M * (1 - Order) + M * (2 - y[Core_r1] - y[Core_r2]) >= Omega_r2);
+					con.add(z[r2 - 1] - z[r1 - 1] + M * Order + M * (2 - y[Core_r1] - y[Core_r2]) >= Omega_r1);
+				}
+				else
+				{
+					mod.add(IloIfThen(env, y[Core_r1] + y[Core_r2] == 2,
+						(z[r1 - 1] - z[r2 - 1] >= Omega_r2) + (z[r2 - 1] - z[r1 - 1] >= Omega_r1) == 1));
+				}
+			}
+		}
+	}
+
+	void constraints24
+	(IloBoolVarArray x,
+		IloModel mod,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloIntVarArray z,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int C,
+		const int NoOverlap_Flag,
+		VONEILP::VariableTable& Table)
+	{
+		IloEnv env = con.getEnv();
+		//Every request is embedded, so a time slot is in [1, Bandwidth] and the largest bandwidth is a valid big-M:
+		int M = 0;
+		for (VONETopo::LinkListIT SNTopoIT = Substrate_Network_Edge.begin(); SNTopoIT != Substrate_Network_Edge.end(); SNTopoIT++)
+		{
+			M = max(M, SNTopoIT->_edge_bandwidth);
+		}
+
+		vector<PathPair> Path_Pairs;
+		getSharedPathPairs(Candidate_Paths, static_cast<int>(Substrate_Network_Edge.size()), Path_Pairs);
+		int Omega_r1 = 1;
+		int Omega_r2 = 1;
+		//One order variable for each slot pair of two requests, the first one is at Order_Index. The path pairs of two requests are
+		//    next to each other in Path_Pairs:
+		int Order_Index = -1;
+		for (vector<PathPair>::const_iterator PairIT = Path_Pairs.begin(); PairIT != Path_Pairs.end(); PairIT++)
+		{
+			int r1 = PairIT->_r1;
+			int r2 = PairIT->_r2;
+			if ((NoOverlap_Flag == 1) && ((PairIT == Path_Pairs.begin()) || ((PairIT - 1)->_r1 != r1) || ((PairIT - 1)->_r2 != r2)))
+			{
+				Order_Index = static_cast<int>(x.getSize());
+				for (int slot1 = 1; slot1 <= Virtual_Networks_Bandwidth[r1 - 1]; slot1++)
+				{
+					for (int slot2 = 1; slot2 <= Virtual_Networks_Bandwidth[r2 - 1]; slot2++)
+					{
+						x.add(IloBoolVar(env, Table.add(VONEILP::VariableKey('P', r1, r2,
+							(slot1 - 1) * Virtual_Networks_Bandwidth[r2 - 1] + slot2 - 1, 0, 0))));
+					}
+				}
+			}
+
+			for (int c = 1; c <= C; c++)
+			{
+				int Core_r1 = (c - 1) + (PairIT->_k1 - 1) * C + Accumulate_Candidate_Path_Number[r1 - 1] * C;
+				int Core_r2 = (c - 1) + (PairIT->_k2 - 1) * C + Accumulate_Candidate_Path_Number[r2 - 1] * C;
+				for (int slot1 = 1; slot1 <= Virtual_Networks_Bandwidth[r1 - 1]; slot1++)
+				{
+					for (int slot2 = 1; slot2 <= Virtual_Networks_Bandwidth[r2 - 1]; slot2++)
+					{
+						int Slot_r1 = (slot1 - 1) + Accumulate_Virtual_Networks_Bandwidth[r1 - 1];
+						int Slot_r2 = (slot2 - 1) + Accumulate_Virtual_Networks_Bandwidth[r2 - 1];
+						if (NoOverlap_Flag == 1)
+						{
+							IloBoolVar Order = x[Order_Index + (slot1 - 1) * Virtual_Networks_Bandwidth[r2 - 1] + (slot2 - 1)];
+							con.add(z[Slot_r1] - z[Slot_r2] + M * (1 - Order) + M * (2 - y[Core_r1] - y[Core_r2]) >= Omega_r2);
+							con.add(z[Slot_r2] - z[Slot_r1] + M * Order + M * (2 - y[Core_r1] - y[Core_r2]) >= Omega_r1);
+						}
+						else
+						{
+							mod.add(IloIfThen(env, y[Core_r1] + y[Core_r2] == 2,
+								(z[Slot_r1] - z[Slot_r2] >= Omega_r2) + (z[Slot_r2] - z[Slot_r1] >= Omega_r1) == 1));
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void constraints25
+	(IloModel mod,
+		const IloBoolVarArray x,
+		const IloIntVarArray y,
+		const int TypeFlag,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const VONESpectrum::SpectrumOccupancy& Occupied,
+		const int Slot_Flag,
+		const VONEILP::VarIndex& Index)
+	{
+		IloEnv env = mod.getEnv();
+		vector<pair<int, int> > Runs;
+		for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+		{
+			for (int d = 0; d <= 1; d++)
+			{
+				for (int c = 1; c <= C; c++)
+				{
+					Occupied.get_occupied_runs(sd, d, c, Runs);
+					vector<IfThenOccupied> Rows;
+					for (int r = Start_Request; (r <= Request_Number) && !Runs.empty(); r++)
+					{
+						if (!Candidate_Links[r - 1][sd - 1])
+						{
+							continue;
+						}
+
+						//A time slot of TDM is a block of one slot:
+						for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
+						{
+							for (int slot = 1; slot <= (TypeFlag == 0 ? Virtual_Networks_Bandwidth[r - 1] : 1); slot++)
+							{
+								for (vector<pair<int, int> >::const_iterator RunIT = Runs.begin(); RunIT != Runs.end(); RunIT++)
+								{
+									IfThenOccupied Row;
+									Row._core = Index.core(r, c, sd, d);
+									Row._index = TypeFlag == 0 ? getSlotPosition(r, slot, e, sd, d, Accumulate_Virtual_Networks_Bandwidth,
+										Slot_Flag, Index) : Index.edge(r, e, sd, d);
+									Row._first = RunIT->first;
+									Row._last = RunIT->second;
+									Row._omega = TypeFlag == 0 ? 1 : Virtual_Networks_Bandwidth[r - 1];
+									Rows.push_back(Row);
+								}
+							}
+						}
+					}
+
+					for (vector<IfThenOccupied>::const_iterator RowIT = Rows.begin(); RowIT != Rows.end(); RowIT++)
+					{
+						mod.add(IloIfThen(env, (x[RowIT->_core] == 1) && (y[RowIT->_index] != 0),
+							(y[RowIT->_index] <= RowIT->_first - RowIT->_omega) || (y[RowIT->_index] >= RowIT->_last + 1)));
+					}
+				}
+			}
+		}
+	}
+
+	long long constraints26
+	(IloRangeArray con,
+		const IloBoolVarArray x,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links,
+		const VONEILP::VarIndex& Index)
+	{
+		IloEnv env = con.getEnv();
+		long long Row_Number = 0;
+		for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+		{
+			for (int d = 0; d <= 1; d++)
+			{
+				//Used[c - 1] is the sum of the core c of the requests up to r on this link in this direction:
+				vector<IloExpr> Used;
+				for (int c = 1; c <= C; c++)
+				{
+					Used.push_back(IloExpr(env));
+				}
+				for (int r = 1; r <= Request_Number; r++)
+				{
+					if (!Candidate_Links[r - 1][sd - 1])
+					{
+						continue;
+					}
+					for (int c = 1; c <= C; c++)
+					{
+						Used[c - 1] += x[Index.core(r, c, sd, d)];
+					}
+					for (int c = 2; (c <= C) && (r >= Start_Request); c++)
+					{
+						con.add(x[Index.core(r, c, sd, d)] - Used[c - 2] <= 0);
+						Row_Number++;
+					}
+				}
+				for (int c = 1; c <= C; c++)
+				{
+					Used[c - 1].end();
+				}
+			}
+		}
+
+		return Row_Number;
+	}
+
+	long long constraints27
+	(IloRangeArray con,
+		const IloBoolVarArray x,
+		const int Request_Number,
+		const int Start_Request,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONERequest::DemandClasses& Classes,
+		const VONEILP::VarIndex& Index)
+	{
+		IloEnv env = con.getEnv();
+		long long Row_Number = 0;
+		for (int r = Start_Request; r <= Request_Number; r++)
+		{
+			int Previous = Classes.get_previous(r - 1) + 1;
+			if (Previous == 0)
+			{
+				continue;
+			}
+
+			IloExpr Arc_Order(env);
+			for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+			{
+				for (int d = 0; d <= 1; d++)
+				{
+					for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
+					{
+						Arc_Order += (2 * (sd - 1) + d + 1) * (x[Index.edge(Previous, e, sd, d)] - x[Index.edge(r, e, sd, d)]);
+					}
+				}
+			}
+			con.add(Arc_Order <= 0);
+			Arc_Order.end();
+			Row_Number++;
+		}
+
+		return Row_Number;
+	}
+
+	long long constraints28
+	(IloRangeArray con,
+		const IloBoolVarArray x,
+		const int Request_Number,
+		const vector<VONEPath::PathList>& Candidate_Paths,
+		const vector<int>& Accumulate_Candidate_Path_Number,
+		const VONERequest::DemandClasses& Classes)
+	{
+		IloEnv env = con.getEnv();
+		long long Row_Number = 0;
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			int Previous = Classes.get_previous(r - 1) + 1;
+			if (Previous == 0)
+			{
+				continue;
+			}
+
+			IloExpr Path_Order(env);
+			for (int k = 1; k <= static_cast<int>(Candidate_Paths[r - 1].size()); k++)
+			{
+				Path_Order += k * (x[(k - 1) + Accumulate_Candidate_Path_Number[Previous - 1]] - 
+					x[(k - 1) + Accumulate_Candidate_Path_Number[r - 1]]);
+			}
+			con.add(Path_Order <= 0);
+			Path_Order.end();
+			Row_Number++;
+		}
+
+		return Row_Number;
+	}
+
+	void getClassOrder
+	(const vector<vector<VONEGreedy::EdgeAssignment> >& Assignment,
+		const VONERequest::DemandClasses& Classes,
+		vector<int>& Greedy_Request)
+	{
+		//The weighted arcs of constraints27 of the solution of each request, and the requests of each class in their order:
+		vector<long long> Arc_Order(Assignment.size(), 0);
+		vector<vector<int> > Class_Request(Classes.size());
+		for (size_t r = 0; r < Assignment.size(); r++)
+		{
+			for (vector<VONEGreedy::EdgeAssignment>::const_iterator EdgeIT = Assignment[r].begin(); EdgeIT != Assignment[r].end(); EdgeIT++)
+			{
+				for (vector<VONEGreedy::LinkAssignment>::const_iterator HopIT = EdgeIT->_hop.begin(); HopIT != EdgeIT->_hop.end(); HopIT++)
+				{
+					Arc_Order[r] += 2 * (HopIT->_link - 1) + HopIT->_direction + 1;
+				}
+			}
+			Class_Request[Classes.get_class(r)].push_back(static_cast<int>(r));
+		}
+
+		Greedy_Request.resize(Assignment.size());
+		for (vector<vector<int> >::const_iterator ClassIT = Class_Request.begin(); ClassIT != Class_Request.end(); ClassIT++)
+		{
+			vector<int> Sorted_Request = *ClassIT;
+			stable_sort(Sorted_Request.begin(), Sorted_Request.end(),
+				[&](const int First, const int Second) { return Arc_Order[First] < Arc_Order[Second]; });
+			for (size_t i = 0; i < ClassIT->size(); i++)
+			{
+				Greedy_Request[(*ClassIT)[i]] = Sorted_Request[i];
+			}
+		}
+	}
+
+	void getAssignment
+	(const IloNumArray& Link_Value,
+		const IloNumArray& Core_Value,
+		const IloNumArray& Index_Value,
+		const int TypeFlag,
+		const int Request_Number,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int C,
+		const int Slot_Flag,
+		const VONEILP::VarIndex& Index,
+		vector<vector<VONEGreedy::EdgeAssignment> >& Assignment)
+	{
+		Assignment.assign(Request_Number, vector<VONEGreedy::EdgeAssignment>());
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			Assignment[r - 1].resize(Virtual_Networks_Edge_Number[r - 1]);
+			for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
+			{
+				Assignment[r - 1][e - 1]._bandwidth = Virtual_Networks_Bandwidth[r - 1];
+			}
+
+			for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+			{
+				for (int d = 0; d <= 1; d++)
+				{
+					int Core = 0;
+					for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
+					{
+						if (Link_Value[Index.edge(r, e, sd, d)] < 0.5)
+						{
+							continue;
+						}
+
+						//The next selected core of the link is taken by this virtual edge:
+						Core++;
+						while ((Core < C) && (Core_Value[Index.core(r, Core, sd, d)] < 0.5))
+						{
+							Core++;
+						}
+						VONEGreedy::LinkAssignment Hop;
+						Hop._link = sd;
+						Hop._direction = d;
+						Hop._core = Core;
+						Hop._start = 0;
+						VONEGreedy::EdgeAssignment& Edge = Assignment[r - 1][e - 1];
+						if (TypeFlag != 0)
+						{
+							Hop._start = static_cast<int>(Index_Value[Index.edge(r, e, sd, d)] + 0.5);
+						}
+						else
+						{
+							//The time slots are the same on all links of the virtual edge:
+							for (int slot = 1; (slot <= Virtual_Networks_Bandwidth[r - 1]) && Edge._hop.empty(); slot++)
+							{
+								Edge._slot.push_back(static_cast<int>(Index_Value[getSlotPosition(r, slot, e, sd, d,
+									Accumulate_Virtual_Networks_Bandwidth, Slot_Flag, Index)] + 0.5));
+							}
+							sort(Edge._slot.begin(), Edge._slot.end());
+							Hop._start = Edge._slot.empty() ? 0 : Edge._slot.front();
+						}
+						Edge._hop.push_back(Hop);
+					}
+				}
+			}
+		}
+	}
+
+	void getViolatedPairLinks
+	(const IloNumArray& Core_Value,
+		const IloNumArray& Index_Value,
+		const int TypeFlag,
+		const int Request_Number,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index,
+		vector<PairLink>& Violated_Pair_Links)
+	{
+		Violated_Pair_Links.clear();
+		//One bucket for each direction and each core of a link:
+		vector<vector<Occupation> > Bucket(2 * C);
+		for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+		{
+			for (size_t i = 0; i < Bucket.size(); i++)
+			{
+				Bucket[i].clear();
+			}
+
+			for (int r = 1; r <= Request_Number; r++)
+			{
+				for (int d = 0; d <= 1; d++)
+				{
+					int Core = 0;
+					for (int c = 1; (c <= C) && (Core == 0); c++)
+					{
+						if (Core_Value[Index.core(r, c, sd, d)] > 0.5)
+						{
+							Core = c;
+						}
+					}
+					if (Core == 0)
+					{
+						continue;
+					}
+
+					vector<Occupation>& Core_Bucket = Bucket[2 * (Core - 1) + d];
+					for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
+					{
+						if (TypeFlag == 0)
+						{
+							for (int slot = 1; slot <= Virtual_Networks_Bandwidth[r - 1]; slot++)
+							{
+								int Time_Slot = static_cast<int>(Index_Value[Index.slot(r, slot, e, sd, d)] + 0.5);
+								if (Time_Slot != 0)
+								{
+									Occupation Slot_Occupation = { Time_Slot, Time_Slot, r };
+									Core_Bucket.push_back(Slot_Occupation);
+								}
+							}
+						}
+						else
+						{
+							int Start_Index = static_cast<int>(Index_Value[Index.edge(r, e, sd, d)] + 0.5);
+							if (Start_Index != 0)
+							{
+								Occupation Spectrum_Occupation = { Start_Index, Start_Index + Virtual_Networks_Bandwidth[r - 1] - 1, r };
+								Core_Bucket.push_back(Spectrum_Occupation);
+							}
+						}
+					}
+				}
+			}
+
+			//Sweep the occupations of each core in the order of their start, only the ones starting before the end of an occupation
+			//    can overlap with it:
+			for (size_t i = 0; i < Bucket.size(); i++)
+			{
+				sort(Bucket[i].begin(), Bucket[i].end(), less_occupation);
+				for (size_t j = 0; j < Bucket[i].size(); j++)
+				{
+					for (size_t k = j + 1; (k < Bucket[i].size()) && (Bucket[i][k]._start <= Bucket[i][j]._end); k++)
+					{
+						if (Bucket[i][k]._request != Bucket[i][j]._request)
+						{
+							PairLink Violated = { min(Bucket[i][j]._request, Bucket[i][k]._request),
+								max(Bucket[i][j]._request, Bucket[i][k]._request), sd };
+							Violated_Pair_Links.push_back(Violated);
+						}
+					}
+				}
+			}
+		}
+
+		sort(Violated_Pair_Links.begin(), Violated_Pair_Links.end(), less_pair_link);
+		Violated_Pair_Links.erase(unique(Violated_Pair_Links.begin(), Violated_Pair_Links.end(), equal_pair_link),
+			Violated_Pair_Links.end());
+	}
+
+	long long getNoOverlapRowNumber
+	(const int TypeFlag,
+		const int NoOverlap_Flag,
+		const int Request_Number,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const vector<vector<bool> >& Candidate_Links)
+	{
+		//The constraints of a request pair on a link are the product of the weights of both requests, so the sum over all pairs
+		//    is a half of the square of the sum minus the sum of the squares:
+		long long Row_Number = 0;
+		for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+		{
+			long long Sum = 0, Square_Sum = 0;
+			for (int r = 1; r <= Request_Number; r++)
+			{
+				if (Candidate_Links[r - 1][sd - 1])
+				{
+					long long Weight = Virtual_Networks_Edge_Number[r - 1];
+					if (TypeFlag == 0)
+					{
+						Weight *= Virtual_Networks_Bandwidth[r - 1];
+					}
+					Sum += Weight;
+					Square_Sum += Weight * Weight;
+				}
+			}
+			Row_Number += (Sum * Sum - Square_Sum) / 2;
+		}
+
+		return Row_Number * 2 * C * (NoOverlap_Flag == 1 ? 2 : 1);
+	}
+
+	bool getGreedyStart
+	(IloNumVarArray Start_Variables,
+		IloNumArray Start_Values,
+		const IloBoolVarArray Node,
+		const IloBoolVarArray Link,
+		const IloBoolVarArray Core,
+		const IloIntVarArray Index_Variables,
+		const IloIntVarArray End,
+		const VONEGreedy::VONEGreedy& Greedy,
+		const int TypeFlag,
+		const int Request_Number,
+		const int Substrate_Network_Vertex_Number,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Vertex_Number,
+		const vector<vector<int> >& Computing_Capacity_in_Virtual_Vertexes,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const vector<int>& Accumulate_Virtual_Networks_Bandwidth,
+		const int Slot_Flag,
+		const int Symmetry_Flag,
+		const vector<int>& Greedy_Request,
+		const VONEILP::VarIndex& Index)
+	{
+		if (Greedy.get_blocked_number() > 0)
+		{
+			return false;
+		}
+
+		//The variables which are not set by the greedy solution are 0, and the spectrum end index of an unused link is Omega - 1:
+		vector<IloNum> Node_Value(static_cast<size_t>(Node.getSize()), 0);
+		vector<IloNum> Link_Value(static_cast<size_t>(Link.getSize()), 0);
+		vector<IloNum> Core_Value(static_cast<size_t>(Core.getSize()), 0);
+		vector<IloNum> Index_Value(static_cast<size_t>(Index_Variables.getSize()), 0);
+		vector<IloNum> End_Value(static_cast<size_t>(End.getSize()), 0);
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			for (int v = 1; v <= Virtual_Networks_Vertex_Number[r - 1]; v++)
+			{
+				for (int s = 1; s <= Substrate_Network_Vertex_Number; s++)
+				{
+					Node_Value[Index.node(r, v, s)] = Computing_Capacity_in_Virtual_Vertexes[r - 1][v - 1] == s ? 1 : 0;
+				}
+			}
+		}
+		for (int r = 1; (r <= Request_Number) && (TypeFlag != 0); r++)
+		{
+			for (int sd = 1; sd <= Substrate_Network_Edge_Number; sd++)
+			{
+				for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
+				{
+					End_Value[Index.edge(r, e, sd, 0)] = Virtual_Networks_Bandwidth[r - 1] - 1;
+					End_Value[Index.edge(r, e, sd, 1)] = Virtual_Networks_Bandwidth[r - 1] - 1;
+				}
+			}
+		}
+
+		//Core_Label[2 * (sd - 1) + d][c] is the label of the core c of the greedy solution on the link sd in the direction d:
+		vector<vector<int> > Core_Label(2 * Substrate_Network_Edge_Number);
+		vector<int> Label_Number(2 * Substrate_Network_Edge_Number, 0);
+		const vector<vector<VONEGreedy::EdgeAssignment> >& Assignment = Greedy.get_assignment();
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			const vector<VONEGreedy::EdgeAssignment>& Request_Assignment = Assignment[Greedy_Request.empty() ? r - 1 : Greedy_Request[r - 1]];
+			for (size_t e = 1; e <= Request_Assignment.size(); e++)
+			{
+				const VONEGreedy::EdgeAssignment& Edge = Request_Assignment[e - 1];
+				for (vector<VONEGreedy::LinkAssignment>::const_iterator HopIT = Edge._hop.begin(); HopIT != Edge._hop.end(); HopIT++)
+				{
+					int Position = Index.edge(r, static_cast<int>(e), HopIT->_link, HopIT->_direction);
+					int Core = HopIT->_core;
+					if (Symmetry_Flag == 1)
+					{
+						size_t Link_Direction = 2 * (HopIT->_link - 1) + HopIT->_direction;
+						vector<int>& Labels = Core_Label[Link_Direction];
+						if (static_cast<int>(Labels.size()) <= Core)
+						{
+							Labels.resize(Core + 1, 0);
+						}
+						if (Labels[Core] == 0)
+						{
+							Label_Number[Link_Direction]++;
+							Labels[Core] = Label_Number[Link_Direction];
+						}
+						Core = Labels[Core];
+					}
+					int Core_Position = Index.core(r, Core, HopIT->_link, HopIT->_direction);
+					if (Core_Value[Core_Position] != 0)
+					{
+						return false;
+					}
+					Link_Value[Position] = 1;
+					Core_Value[Core_Position] = 1;
+					if (TypeFlag != 0)
+					{
+						Index_Value[Position] = HopIT->_start;
+						End_Value[Position] = HopIT->_start + Virtual_Networks_Bandwidth[r - 1] - 1;
+						continue;
+					}
+					for (size_t slot = 1; slot <= Edge._slot.size(); slot++)
+					{
+						Index_Value[getSlotPosition(r, static_cast<int>(slot), static_cast<int>(e), HopIT->_link, HopIT->_direction,
+							Accumulate_Virtual_Networks_Bandwidth, Slot_Flag, Index)] = Edge._slot[slot - 1];
+					}
+				}
+			}
+		}
+
+		for (IloInt i = 0; i < Node.getSize(); i++)
+		{
+			Start_Variables.add(Node[i]);
+			Start_Values.add(Node_Value[i]);
+		}
+		for (IloInt i = 0; i < Link.getSize(); i++)
+		{
+			Start_Variables.add(Link[i]);
+			Start_Values.add(Link_Value[i]);
+		}
+		for (IloInt i = 0; i < Core.getSize(); i++)
+		{
+			Start_Variables.add(Core[i]);
+			Start_Values.add(Core_Value[i]);
+		}
+		for (IloInt i = 0; i < Index_Variables.getSize(); i++)
+		{
+			Start_Variables.add(Index_Variables[i]);
+			Start_Values.add(Index_Value[i]);
+		}
+		for (IloInt i = 0; i < End.getSize(); i++)
+		{
+			Start_Variables.add(End[i]);
+			Start_Values.add(End_Value[i]);
+		}
+		return true;
+	}
+
+	bool less_pair_link(const PairLink& FirstPairLink, const PairLink& SecondPairLink)
+	{
+		if (FirstPairLink._sd != SecondPairLink._sd)
+		{
+			return FirstPairLink._sd < SecondPairLink._sd;
+		}
+		if (FirstPairLink._r1 != SecondPairLink._r1)
+		{
+			return FirstPairLink._r1 < SecondPairLink._r1;
+		}
+		return FirstPairLink._r2 < SecondPairLink._r2;
+	}
+
+	bool equal_pair_link(const PairLink& FirstPairLink, const PairLink& SecondPairLink)
+	{
+		return (FirstPairLink._sd == SecondPairLink._sd) && (FirstPairLink._r1 == SecondPairLink._r1)
+			&& (FirstPairLink._r2 == SecondPairLink._r2);
+	}
+
+	bool less_occupation(const Occupation& FirstOccupation, const Occupation& SecondOccupation)
+	{
+		return FirstOccupation._start < SecondOccupation._start;
+	}
+	void getNoOverlapRows8
+	(const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index,
+		vector<IfThenNoOverlap>& Rows)
+	{
+		for (int c = 1; c <= C; c++)
+		{
+			for (int e1 = 1; e1 <= Virtual_Networks_Edge_Number[r1 - 1]; e1++)
+			{
+				for (int e2 = 1; e2 <= Virtual_Networks_Edge_Number[r2 - 1]; e2++)
+				{
+					//Without taking the cross-talk between two adjacent cores into account:
+					for (int d = 0; d <= 1; d++)
+					{
+						IfThenNoOverlap Row;
+						Row._core_r1 = Index.core(r1, c, sd, d);
+						Row._core_r2 = Index.core(r2, c, sd, d);
+						Row._index_r1 = Index.edge(r1, e1, sd, d);
+						Row._index_r2 = Index.edge(r2, e2, sd, d);
+						Row._omega_r1 = Virtual_Networks_Bandwidth[r1 - 1];
+						Row._omega_r2 = Virtual_Networks_Bandwidth[r2 - 1];
+						Rows.push_back(Row);
+					}
+				}
+			}
+		}
+	}
+
+	void getNoOverlapRows9
+	(const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index,
+		vector<IfThenNoOverlap>& Rows)
+	{
+		for (int slot1 = 1; slot1 <= Virtual_Networks_Bandwidth[r1 - 1]; slot1++)
+		{
+			for (int slot2 = 1; slot2 <= Virtual_Networks_Bandwidth[r2 - 1]; slot2++)
+			{
+				for (int e1 = 1; e1 <= Virtual_Networks_Edge_Number[r1 - 1]; e1++)
+				{
+					for (int e2 = 1; e2 <= Virtual_Networks_Edge_Number[r2 - 1]; e2++)
+					{
+						for (int c = 1; c <= C; c++)
+						{
+							for (int d = 0; d <= 1; d++)
+							{
+								IfThenNoOverlap Row;
+								Row._core_r1 = Index.core(r1, c, sd, d);
+								Row._core_r2 = Index.core(r2, c, sd, d);
+								Row._index_r1 = Index.slot(r1, slot1, e1, sd, d);
+								Row._index_r2 = Index.slot(r2, slot2, e2, sd, d);
+								Row._omega_r1 = 1;
+								Row._omega_r2 = 1;
+								Rows.push_back(Row);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void getConsistencyRows11
+	(const int r,
+		const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const VONEILP::VarIndex& Index,
+		vector<IfThenConsistency>& Rows)
+	{
+		for (int slot = 1; slot <= Virtual_Networks_Bandwidth[r - 1]; slot++)
+		{
+			for (int sd1 = 1; sd1 <= Substrate_Network_Edge_Number; sd1++)
+			{
+				for (int sd2 = 1; sd2 <= Substrate_Network_Edge_Number; sd2++)
+				{
+					for (int e = 1; e <= Virtual_Networks_Edge_Number[r - 1]; e++)
+					{
+						if (sd1 != sd2)
+						{
+							//Both directions of the two links:
+							for (int d1 = 0; d1 <= 1; d1++)
+							{
+								for (int d2 = 0; d2 <= 1; d2++)
+								{
+									IfThenConsistency Row;
+									Row._link_1 = Index.edge(r, e, sd1, d1);
+									Row._link_2 = Index.edge(r, e, sd2, d2);
+									Row._index_1 = Index.slot(r, slot, e, sd1, d1);
+									Row._index_2 = Index.slot(r, slot, e, sd2, d2);
+									Rows.push_back(Row);
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void getNoOverlapRows16
+	(const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index,
+		BigMNoOverlapBuffer& Rows)
+	{
+		int Order_Number = 0;
+		//The start index of a used link is in [1, Bandwidth + 1 - Omega], so the bandwidth is enough to separate two used
+		//    start indexes, and one more slot is needed when a start index of an unused link is 0:
+		int M_order = Substrate_Network_Edge[sd - 1]._edge_bandwidth;
+		int M_core = M_order + 1;
+		for (int e1 = 1; e1 <= Virtual_Networks_Edge_Number[r1 - 1]; e1++)
+		{
+			for (int e2 = 1; e2 <= Virtual_Networks_Edge_Number[r2 - 1]; e2++)
+			{
+				//A request uses at most one direction and one core on a link, so one order variable serves both directions and all cores:
+				Rows._order_key.push_back(VONEILP::VariableKey('O', r1, r2, Order_Number, sd, 0));
+				Order_Number++;
+
+				for (int d = 0; d <= 1; d++)
+				{
+					BigMNoOverlap Row;
+					Row._order = static_cast<int>(Rows._order_key.size()) - 1;
+					Row._index_r1 = Index.edge(r1, e1, sd, d);
+					Row._index_r2 = Index.edge(r2, e2, sd, d);
+					//The core variables only tell the link is used by one of the virtual edges of a request:
+					Row._link_r1 = Virtual_Networks_Edge_Number[r1 - 1] > 1 ? Row._index_r1 : -1;
+					Row._link_r2 = Virtual_Networks_Edge_Number[r2 - 1] > 1 ? Row._index_r2 : -1;
+					Row._m_order = M_order;
+					Row._m_core = M_core;
+					Row._omega_r1 = Virtual_Networks_Bandwidth[r1 - 1];
+					Row._omega_r2 = Virtual_Networks_Bandwidth[r2 - 1];
+
+					for (int c = 1; c <= C; c++)
+					{
+						Row._core_r1 = Index.core(r1, c, sd, d);
+						Row._core_r2 = Index.core(r2, c, sd, d);
+						Rows._row.push_back(Row);
+					}
+				}
+			}
+		}
+	}
+
+	void getNoOverlapRows17
+	(const int r1,
+		const int r2,
+		const int sd,
+		const vector<int>& Virtual_Networks_Edge_Number,
+		const VONETopo::LinkList& Substrate_Network_Edge,
+		const vector<int>& Virtual_Networks_Bandwidth,
+		const int C,
+		const VONEILP::VarIndex& Index,
+		BigMNoOverlapBuffer& Rows)
+	{
+		int Order_Number = 0;
+		//The time slot of a used link is in [1, Bandwidth], so the bandwidth is enough to separate two used time slots,
+		//    and one more slot is needed when a time slot of an unused link is 0:
+		int M_order = Substrate_Network_Edge[sd - 1]._edge_bandwidth;
+		int M_core = M_order + 1;
+		for (int slot1 = 1; slot1 <= Virtual_Networks_Bandwidth[r1 - 1]; slot1++)
+		{
+			for (int slot2 = 1; slot2 <= Virtual_Networks_Bandwidth[r2 - 1]; slot2++)
+			{
+				for (int e1 = 1; e1 <= Virtual_Networks_Edge_Number[r1 - 1]; e1++)
+				{
+					for (int e2 = 1; e2 <= Virtual_Networks_Edge_Number[r2 - 1]; e2++)
+					{
+						Rows._order_key.push_back(VONEILP::VariableKey('O', r1, r2, Order_Number, sd, 0));
+						Order_Number++;
+
+						for (int d = 0; d <= 1; d++)
+						{
+							BigMNoOverlap Row;
+							Row._order = static_cast<int>(Rows._order_key.size()) - 1;
+							int Link_r1 = Index.edge(r1, e1, sd, d);
+							int Link_r2 = Index.edge(r2, e2, sd, d);
+							Row._link_r1 = Virtual_Networks_Edge_Number[r1 - 1] > 1 ? Link_r1 : -1;
+							Row._link_r2 = Virtual_Networks_Edge_Number[r2 - 1] > 1 ? Link_r2 : -1;
+							Row._index_r1 = Index.slot(r1, slot1, e1, sd, d);
+							Row._index_r2 = Index.slot(r2, slot2, e2, sd, d);
+							Row._m_order = M_order;
+							Row._m_core = M_core;
+							Row._omega_r1 = 1;
+							Row._omega_r2 = 1;
+
+							for (int c = 1; c <= C; c++)
+							{
+								Row._core_r1 = Index.core(r1, c, sd, d);
+								Row._core_r2 = Index.core(r2, c, sd, d);
+								Rows._row.push_back(Row);
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	int addIfThenNoOverlap(IloModel mod, const IloBoolVarArray x, const IloIntVarArray y, const vector<IfThenNoOverlap>& Rows)
+	{
+		IloEnv env = mod.getEnv();
+		for (vector<IfThenNoOverlap>::const_iterator RowIT = Rows.begin(); RowIT != Rows.end(); RowIT++)
+		{
+			mod.add(IloIfThen(env,
+				((x[RowIT->_core_r1] + x[RowIT->_core_r2] == 2) && (y[RowIT->_index_r1] != 0) && (y[RowIT->_index_r2] != 0)),
+				(y[RowIT->_index_r1] - y[RowIT->_index_r2] >= RowIT->_omega_r2) + 
+				(y[RowIT->_index_r2] - y[RowIT->_index_r1] >= RowIT->_omega_r1) == 1));
+		}
+
+		return static_cast<int>(Rows.size());
+	}
+
+	int addIfThenConsistency(IloModel mod, const IloIntVarArray x, const IloBoolVarArray y, const vector<IfThenConsistency>& Rows)
+	{
+		IloEnv env = mod.getEnv();
+		for (vector<IfThenConsistency>::const_iterator RowIT = Rows.begin(); RowIT != Rows.end(); RowIT++)
+		{
+			mod.add(IloIfThen(env, y[RowIT->_link_1] + y[RowIT->_link_2] == 2, x[RowIT->_index_1] - x[RowIT->_index_2] == 0));
+		}
+
+		return static_cast<int>(Rows.size());
+	}
+
+	int addBigMNoOverlap
+	(IloBoolVarArray x,
+		IloRangeArray con,
+		const IloBoolVarArray y,
+		const IloBoolVarArray l,
+		const IloIntVarArray z,
+		const BigMNoOverlapBuffer& Rows,
+		VONEILP::VariableTable& Table)
+	{
+		IloEnv env = con.getEnv();
+		IloInt Order_Start = x.getSize();
+		for (vector<VONEILP::VariableKey>::const_iterator KeyIT = Rows._order_key.begin(); KeyIT != Rows._order_key.end(); KeyIT++)
+		{
+			x.add(IloBoolVar(env, Table.add(*KeyIT)));
+		}
+
+		for (vector<BigMNoOverlap>::const_iterator RowIT = Rows._row.begin(); RowIT != Rows._row.end(); RowIT++)
+		{
+			IloBoolVar Order = x[Order_Start + RowIT->_order];
+			IloExpr link_release(env);
+			if (RowIT->_link_r1 >= 0)
+			{
+				link_release += 1 - l[RowIT->_link_r1];
+			}
+			if (RowIT->_link_r2 >= 0)
+			{
+				link_release += 1 - l[RowIT->_link_r2];
+			}
+
+			con.add(z[RowIT->_index_r1] - z[RowIT->_index_r2] + RowIT->_m_order * (1 - Order)
+				+ RowIT->_m_core * (2 - y[RowIT->_core_r1] - y[RowIT->_core_r2] + link_release) >= RowIT->_omega_r2);
+			con.add(z[RowIT->_index_r2] - z[RowIT->_index_r1] + RowIT->_m_order * Order
+				+ RowIT->_m_core * (2 - y[RowIT->_core_r1] - y[RowIT->_core_r2] + link_release) >= RowIT->_omega_r1);
+			link_release.end();
+		}
+
+		return 2 * static_cast<int>(Rows._row.size());
+	}
+
+	void getRequestChunks(const vector<long long>& Request_Work, const int Thread_Number, vector<pair<int, int> >& Chunks)
+	{
+		//About 64 chunks for each thread, so at most Thread_Number chunks of native rows are buffered at the same time:
+		long long Total_Work = accumulate(Request_Work.begin(), Request_Work.end(), 0LL);
+		long long Chunk_Work = max(1LL, Total_Work / (64LL * max(1, Thread_Number)));
+
+		Chunks.clear();
+		int First_Request = 1;
+		long long Work = 0;
+		for (int r = 1; r <= static_cast<int>(Request_Work.size()); r++)
+		{
+			Work += Request_Work[r - 1];
+			if ((Work >= Chunk_Work) || (r == static_cast<int>(Request_Work.size())))
+			{
+				Chunks.push_back(make_pair(First_Request, r));
+				First_Request = r + 1;
+				Work = 0;
+			}
+		}
+	}
+
+	template <class Buffer, class Generator, class Materializer>
+	void buildRowsInParallel(const vector<pair<int, int> >& Chunks, const int Thread_Number, Generator Generate, Materializer Materialize)
+	{
+		if (Thread_Number <= 1)
+		{
+			for (vector<pair<int, int> >::const_iterator ChunkIT = Chunks.begin(); ChunkIT != Chunks.end(); ChunkIT++)
+			{
+				Buffer Rows;
+				Generate(ChunkIT->first, ChunkIT->second, Rows);
+				Materialize(Rows);
+			}
+			return;
+		}
+
+		//The chunks are processed in waves of Thread_Number chunks, the worker threads generate the next wave while the calling
+		//    thread materializes the current one:
+		//    An exception of a worker is kept with its chunk and thrown again by the calling thread in the order of the chunks:
+		size_t Wave_Size = static_cast<size_t>(Thread_Number);
+		vector<vector<Buffer> > Wave_Rows(2, vector<Buffer>(Wave_Size));
+		vector<vector<exception_ptr> > Wave_Errors(2, vector<exception_ptr>(Wave_Size));
+		vector<thread> Workers;
+		auto start_wave = [&](const size_t Wave_Start, vector<Buffer>& Rows, vector<exception_ptr>& Errors)
+		{
+			for (size_t i = 0; (i < Wave_Size) && (Wave_Start + i < Chunks.size()); i++)
+			{
+				Rows[i] = Buffer();
+				Errors[i] = exception_ptr();
+				Workers.push_back(thread([&Generate, &Chunks, &Rows, &Errors, Wave_Start, i]()
+				{
+					try
+					{
+						Generate(Chunks[Wave_Start + i].first, Chunks[Wave_Start + i].second, Rows[i]);
+					}
+					catch (...)
+					{
+						Errors[i] = current_exception();
+					}
+				}));
+			}
+		};
+		auto join_wave = [&]()
+		{
+			for (vector<thread>::iterator WorkerIT = Workers.begin(); WorkerIT != Workers.end(); WorkerIT++)
+			{
+				WorkerIT->join();
+			}
+			Workers.clear();
+		};
+
+		try
+		{
+			start_wave(0, Wave_Rows[0], Wave_Errors[0]);
+			for (size_t Wave = 0; Wave * Wave_Size < Chunks.size(); Wave++)
+			{
+				join_wave();
+				vector<Buffer>& Current_Rows = Wave_Rows[Wave % 2];
+				for (size_t i = 0; i < Wave_Size; i++)
+				{
+					if (Wave_Errors[Wave % 2][i])
+					{
+						rethrow_exception(Wave_Errors[Wave % 2][i]);
+					}
+				}
+				if ((Wave + 1) * Wave_Size < Chunks.size())
+				{
+					start_wave((Wave + 1) * Wave_Size, Wave_Rows[(Wave + 1) % 2], Wave_Errors[(Wave + 1) % 2]);
+				}
+
+				for (size_t i = 0; (i < Wave_Size) && (Wave * Wave_Size + i < Chunks.size()); i++)
+				{
+					Materialize(Current_Rows[i]);
+					Current_Rows[i] = Buffer();
+				}
+			}
+		}
+		catch (...)
+		{
+			join_wave();
+			throw;
+		}
+	}
+
+	template <class VarArray>
+	void addNewVariables(IloIntVarArray All_Variables, const VarArray x, const IloInt First)
+	{
+		for (IloInt i = First; i < x.getSize(); i++)
+		{
+			All_Variables.add(x[i]);
+		}
+	}
+}
+#endif
@@ -9,21 +9,74 @@
 #pragma once
 #include <ilcplex/ilocplex.h>
 #include "Topo.h"
+#include "Variable.h"
+#include "Greedy.h"
 ILOSTLBEGIN
 
 namespace VONEILP
 {
+	//The options to select the formulation of the ILP, the default values build the original model
+	struct ILPOption
+	{
+		ILPOption();
+
+		int _nooverlap_flag;	//0 is the logical IloIfThen no-overlap, 1 is the linearized big-M no-overlap
+		int _hop_slack;			//A request only uses the links on its paths at most _hop_slack hops longer than the shortest one, 
+								//    negative for all links
+		int _path_number;		//0 is the arc-flow formulation, k > 0 is the path formulation over the k shortest paths of each request
+		int _lazy_flag;			//0 builds all no overlap constraints, 1 adds them only for the request pairs overlapping in a solution
+		int _thread_number;		//The number of threads generating the no overlap and time slot consistency constraints
+		int _name_flag;			//1 names the variables when they are created, 0 only records their keys and names them when needed
+		int _export_flag;		//1 exports the model to the .lp file, 0 skips the export
+		int _start_flag;		//1 gives the solution of the greedy engine to CPLEX as a MIP start of the arc-flow formulation
+								//    (not with the global offsets of WDM or OFDM), 0 solves from a cold model
+		int _window_size;		//0 solves all requests in one model, N > 0 solves them in windows of N requests by the class VONERolling
+		int _window_overlap;	//The number of the last requests of a window which are solved again in the next window
+		int _batch_size;		//0 solves all requests at once, N > 0 adds the requests in batches of N to one model by add_requests
+		int _rebuild_flag;		//1 also solves a new model of the same requests after each batch to compare the latency, 0 does not
+		string _path_table;		//The binary path table of the candidate paths of the path formulation, empty to compute them on
+								//    every run
+		int _slot_flag;			//0 gives each link of a TDM request its own time slots tied by the consistency constraints, 1 is the 
+								//    compact formulation whose time slots belong to the request
+		int _consistency_flag;	//0 ties the time slots of each two links of a TDM request by logical constraints (none for WDM or OFDM),
+								//    1 ties the index of each link to a global offset of the virtual edge by linear constraints
+		int _symmetry_flag;		//1 breaks the symmetry of the interchangeable cores of each link in the arc-flow formulation, 0 does not
+		int _aggregate_flag;	//1 groups the identical requests into classes and orders the requests of each class, 0 does not
+		int _column_round;		//The most rounds of pricing of the column generation engine before its integer phase
+	};
+
 	//Create CPLEX class to solve ILP of VONE
 	class VONECplex
 	{
 	public:
 		VONECplex();
 
-		void solve(const VONETopo::Topo& Substrate_Network, const vector<VONETopo::Topo>& Virtual_Network_List, int TypeFlag, int CoreNum);
-		//Precondition: Topologies of substrate netwrok and virtual networks have been assigned, 
+		void solve(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests, int TypeFlag, int CoreNum,
+			const ILPOption& Option = ILPOption(), const VONESpectrum::SpectrumOccupancy* Occupied = 0);
+		//Precondition: Topology of substrate netwrok and the requests have been assigned, 
 		//    TypeFlag has been assigned and CoreNum has been given
-		//Postcondition: Solve the integer linear programming of VONE based on the Substrate_Network and Virtual_Network_List 
-		//    for TypeFlag service over CoreNum topology
+		//Postcondition: Solve the integer linear programming of VONE based on the Substrate_Network and Requests 
+		//    for TypeFlag service over CoreNum topology, the formulation is selected by Option. If Occupied is given, its slots are 
+		//    taken by the requests embedded before and the maximum index is at least its highest slot (only for the arc-flow formulation)
+
+		void add_requests(const VONERequest::RequestTable& New_Requests);
+		//Precondition: The arc-flow formulation without the lazy no overlap constraints has been solved by solve with a positive
+		//    _batch_size of its option, so the input of the model has been kept
+		//Postcondition: The requests of New_Requests are appended to the requests of the model, only their variables and 
+		//    constraints and the no overlap constraints pairing them with the other requests are added, and the model is solved 
+		//    again from the last solution as a MIP start
+
+		double get_latency() const;
+		//Postcondition: Return the wall time in ms of the building, extracting and solving of the last solve or add_requests
+
+		IloNum get_objective() const;
+		//Precondition: The model has a solution
+		//Postcondition: Return the objective of the solution
+
+		bool get_assignment(vector<vector<VONEGreedy::EdgeAssignment> >& Assignment);
+		//Precondition: The arc-flow formulation has been solved
+		//Postcondition: Return false if there is no solution, otherwise Assignment holds the links, cores and start indexes 
+		//    (or time slots) of each virtual edge of each request in the solution
 
 		friend ostream& operator <<(ostream& outs, VONECplex& VONEILP);
 		//Precondition: outs has been connected to an out stream
@@ -32,6 +85,18 @@ namespace VONEILP
 		~VONECplex();
 
 	private:
+		void build_arc_flow(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests,
+			const int Start_Request, const int RNum, const int SVNum, const int SENum, const vector<int>& VVNum, const vector<vector<int> >& C_r_v,
+			const VONETopo::LinkList& SGraph, const vector<VONETopo::LinkList>& VsGraph, const vector<int>& VENum, const vector<int>& VEBw,
+			const vector<int>& AVENumBw, const vector<vector<bool> >& Candidate_r_s_d, IloExpr& Obj);
+		//Precondition: The parameters of the ILP of all requests have been computed by the functions of ILP.cpp from Substrate_Network
+		//    and Requests, and the variables and constraints of the requests before Start_Request have been built
+		//Postcondition: The variables and constraints of the arc-flow formulation of the requests from Start_Request and the pairs of
+		//    them with all requests have been added to the model, and Obj is the objective of all requests
+
+		void count_candidate_links(const int RNum, const int SENum, const vector<vector<bool> >& Candidate_r_s_d);
+		//Postcondition: The statistics of the candidate links of all requests have been computed and printed
+
 		IloEnv _env;
 
 		IloModel _model;
@@ -40,5 +105,77 @@ namespace VONEILP
 		IloRangeArray _constraints;
 
 		IloCplex _cplex;
+		IloExpr _hop_number;
+
+		//The node, link, core, start index (or time slot) and spectrum end index variables of the arc-flow formulation:
+		IloBoolVarArray _node_variables;
+		IloBoolVarArray _link_variables;
+		IloBoolVarArray _core_variables;
+		IloIntVarArray _index_variables;
+		IloIntVarArray _end_variables;
+
+		//The parameters of the arc-flow formulation to read its solution:
+		int _type_flag;
+		int _core_number;
+		int _substrate_edge_number;
+		vector<int> _virtual_edge_number;
+		vector<int> _bandwidth;
+
+		//The input of the model kept to add new requests when _batch_size of _option is positive, _occupied is only used when
+		//    _occupied_flag is 1:
+		ILPOption _option;
+		VONETopo::Topo _substrate_network;
+		VONERequest::RequestTable _requests;
+		int _occupied_flag;
+		VONESpectrum::SpectrumOccupancy _occupied;
+
+		//The keys of the variables of the arc-flow formulation in the order of _variables when they are not named:
+		VariableTable _variable_table;
+
+		//The positions of the variables of the arc-flow formulation in their variable arrays:
+		VarIndex _var_index;
+
+		//Statistics of the solving process, the times are the wall times in ms:
+		double _build_time;
+		double _extract_time;
+		double _solve_time;
+		IloNum _root_bound;
+
+		//Statistics of the MIP start, the times are the wall times in ms and _first_incumbent_time is from the start of solve:
+		int _start_flag;
+		int _greedy_blocked_number;
+		double _greedy_time;
+		IloNum _greedy_objective;
+		IloNum _first_incumbent_time;
+		IloNum _first_incumbent;
+
+		//Statistics of the path cache of the candidate paths of the path formulation, empty for the arc-flow formulation:
+		string _path_statistics;
+
+		//Statistics of the candidate links pruning:
+		long long _candidate_link_number;
+		long long _pair_link_number;
+		long long _candidate_pair_link_number;
+
+		//Statistics of the requests added to the solved model:
+		int _batch_number;
+		int _added_request_number;
+
+		//Statistics of the lazy no overlap constraints:
+		int _lazy_round;
+		long long _lazy_pair_link_number;
+		long long _lazy_row_number;
+		long long _full_row_number;
+
+		//Statistics of the spectrum (or time slot) consistency constraints of the arc-flow formulation:
+		long long _consistency_row_number;
+		long long _offset_number;
+
+		//Statistics of the core symmetry breaking constraints:
+		long long _symmetry_row_number;
+
+		//The classes of the identical requests of the model and the statistics of their ordering constraints:
+		VONERequest::DemandClasses _demand_classes;
+		long long _aggregate_row_number;
 	};
 }
@@ -0,0 +1,254 @@
+//This file defines class TrafficLoader
+//------------------------------------------------
+//File Name: Loader.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#include "Loader.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <fstream>
+#ifdef _WIN32
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+	bool isSpace(const char Character);
+	//Postcondition: Return true if Character is a white space of the stream input
+}
+
+namespace VONELoader
+{
+	TrafficLoader::TrafficLoader() :_parsed_bytes(0), _load_time(0)
+	{
+
+	}
+
+	int TrafficLoader::load(const string& TrafficFileName, int TypeFlag, int NumberofTraffic)
+	{
+		chrono::steady_clock::time_point load_start = chrono::steady_clock::now();
+		_request.clear();
+		_parsed_bytes = 0;
+		MappedFile File;
+		if (!map_file(TrafficFileName, File))
+		{
+			cerr << "Traffic input file opened failed.\n";
+			return -2;
+		}
+
+		//A request has 8 bytes at least, like "1 2 0 1\n":
+		int ErrorFlag = 0;
+		const char* Position = File._data;
+		const char* End = File._data + File._size;
+		_request.reserve(min(static_cast<size_t>(max(NumberofTraffic, 0)), File._size / 8 + 1));
+		while (static_cast<int>(_request.size()) != NumberofTraffic)
+		{
+			int Values[4];
+			bool Parsed = true;
+			for (int i = 0; (i < 4) && Parsed; i++)
+			{
+				while ((Position != End) && isSpace(*Position))
+				{
+					Position++;
+				}
+				from_chars_result Result = from_chars(Position, End, Values[i]);
+				Parsed = Result.ec == errc();
+				Position = Result.ptr;
+			}
+			if (!Parsed)
+			{
+				break;
+			}
+			if (Values[2] != TypeFlag)
+			{
+				cerr << "Traffic file does not fit its type!\n";
+				ErrorFlag = 1;
+				break;
+			}
+			if (!_request.add(Values[0], Values[1], Values[2], Values[3]))
+			{
+				cerr << "Traffic file does not fit the request table!\n";
+				ErrorFlag = 2;
+				break;
+			}
+		}
+		_parsed_bytes = Position - File._data;
+		unmap_file(File);
+		_load_time = chrono::duration<double, milli>(chrono::steady_clock::now() - load_start).count();
+
+		return ErrorFlag;
+	}
+
+	int TrafficLoader::load_stream(const string& TrafficFileName, int TypeFlag, int NumberofTraffic)
+	{
+		chrono::steady_clock::time_point load_start = chrono::steady_clock::now();
+		_request.clear();
+		_parsed_bytes = 0;
+		ifstream trafficinput;
+		trafficinput.open(TrafficFileName.c_str());
+		if (trafficinput.fail())
+		{
+			cerr << "Traffic input file opened failed.\n";
+			return -2;
+		}
+
+		int ErrorFlag = 0;
+		int Source, Destination, Type, Slot;
+		while ((static_cast<int>(_request.size()) != NumberofTraffic) && (trafficinput >> Source >> Destination >> Type >> Slot))
+		{
+			if (Type != TypeFlag)
+			{
+				cerr << "Traffic file does not fit its type!\n";
+				ErrorFlag = 1;
+				break;
+			}
+			if (!_request.add(Source, Destination, Type, Slot))
+			{
+				cerr << "Traffic file does not fit the request table!\n";
+				ErrorFlag = 2;
+				break;
+			}
+		}
+
+		//The stream has no position after the end of the file, where all bytes are parsed:
+		streamoff Position = trafficinput.tellg();
+		if (Position < 0)
+		{
+			trafficinput.clear();
+			trafficinput.seekg(0, ios::end);
+			Position = trafficinput.tellg();
+		}
+		_parsed_bytes = Position;
+		trafficinput.close();
+		_load_time = chrono::duration<double, milli>(chrono::steady_clock::now() - load_start).count();
+
+		return ErrorFlag;
+	}
+
+	const VONERequest::RequestTable& TrafficLoader::get_request() const
+	{
+		return _request;
+	}
+
+	ostream& operator <<(ostream& outs, const TrafficLoader& Loader)
+	{
+		outs << "Loaded Requests = " << Loader._request.size() << ", Parsed Bytes = " << Loader._parsed_bytes << ", Parsing Time = "
+			<< Loader._load_time << "ms, Requests per Second = "
+			<< (Loader._load_time > 0 ? Loader._request.size() / Loader._load_time * 1000 : 0) << ", MB per Second = "
+			<< (Loader._load_time > 0 ? Loader._parsed_bytes / Loader._load_time / 1000 : 0) << endl;
+		outs << "Request Table Bytes = " << Loader._request.get_bytes() << ", Bytes per Request = "
+			<< (Loader._request.empty() ? 0 : Loader._request.get_bytes() / Loader._request.size()) << endl;
+		return outs;
+	}
+
+	TrafficLoader::~TrafficLoader()
+	{
+
+	}
+
+	bool map_file(const string& FileName, MappedFile& File)
+	{
+		File._data = NULL;
+		File._size = 0;
+		File._file = NULL;
+		File._mapping = NULL;
+#ifdef _WIN32
+		File._file = CreateFileA(FileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+		LARGE_INTEGER Size;
+		if ((File._file == INVALID_HANDLE_VALUE) || !GetFileSizeEx(File._file, &Size))
+		{
+			unmap_file(File);
+			return false;
+		}
+		File._size = static_cast<size_t>(Size.QuadPart);
+		if (File._size == 0)
+		{
+			return true;
+		}
+		File._mapping = CreateFileMappingA(File._file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (File._mapping != NULL)
+		{
+			File._data = static_cast<const char*>(MapViewOfFile(File._mapping, FILE_MAP_READ, 0, 0, 0));
+		}
+		if (File._data == NULL)
+		{
+			unmap_file(File);
+			return false;
+		}
+#else
+		int Descriptor = open(FileName.c_str(), O_RDONLY);
+		struct stat Status;
+		if ((Descriptor < 0) || (fstat(Descriptor, &Status) != 0))
+		{
+			if (Descriptor >= 0)
+			{
+				close(Descriptor);
+			}
+			return false;
+		}
+		File._size = static_cast<size_t>(Status.st_size);
+		if (File._size > 0)
+		{
+			void* Data = mmap(NULL, File._size, PROT_READ, MAP_PRIVATE, Descriptor, 0);
+			if (Data == MAP_FAILED)
+			{
+				close(Descriptor);
+				return false;
+			}
+			madvise(Data, File._size, MADV_SEQUENTIAL);
+			File._data = static_cast<const char*>(Data);
+		}
+
+		//The mapping is kept after the descriptor is closed:
+		close(Descriptor);
+#endif
+		return true;
+	}
+
+	void unmap_file(MappedFile& File)
+	{
+#ifdef _WIN32
+		if (File._data != NULL)
+		{
+			UnmapViewOfFile(File._data);
+		}
+		if (File._mapping != NULL)
+		{
+			CloseHandle(File._mapping);
+		}
+		if ((File._file != NULL) && (File._file != INVALID_HANDLE_VALUE))
+		{
+			CloseHandle(File._file);
+		}
+#else
+		if (File._data != NULL)
+		{
+			munmap(const_cast<char*>(File._data), File._size);
+		}
+#endif
+		File._data = NULL;
+		File._size = 0;
+		File._file = NULL;
+		File._mapping = NULL;
+	}
+}
+
+namespace
+{
+	bool isSpace(const char Character)
+	{
+		return (Character == ' ') || (Character == '\n') || (Character == '\r') || (Character == '\t') || (Character == '\v')
+			|| (Character == '\f');
+	}
+}
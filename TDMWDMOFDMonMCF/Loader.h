@@ -0,0 +1,64 @@
+//This file declares class TrafficLoader
+//------------------------------------------------
+//File Name: Loader.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include "Request.h"
+#include <string>
+
+namespace VONELoader
+{
+	//A file mapped read-only into memory, _data is NULL for an empty file. _file and _mapping are the handles on Windows
+	struct MappedFile
+	{
+		const char* _data;
+		size_t _size;
+		void* _file;
+		void* _mapping;
+	};
+
+	bool map_file(const string& FileName, MappedFile& File);
+	//Postcondition: Return false if the file fails to open or map, otherwise File holds its bytes, which are kept until unmap_file
+
+	void unmap_file(MappedFile& File);
+	//Precondition: File has been mapped by map_file, or its _data is NULL
+	//Postcondition: The bytes of File are unmapped and the file is closed
+
+	//Load the requests of a traffic file, whose lines are "Source Destination Type Slots", into a request table: the file is mapped into memory and parsed in place by from_chars,
+	//    and the type of each request is checked in the same pass
+	class TrafficLoader
+	{
+	public:
+		TrafficLoader();
+
+		int load(const string& TrafficFileName, int TypeFlag, int NumberofTraffic);
+		//Precondition: TypeFlag has been assigned
+		//Postcondition: Return 0 after the first NumberofTraffic requests of the file (or all if there are fewer) are in the table,
+		//    -2 if the file fails to open or map, 1 if a request is not of TypeFlag, 2 if a request is out of the range of the table.
+		//    Like the stream input, the parsing stops at the first text which is not a number
+
+		int load_stream(const string& TrafficFileName, int TypeFlag, int NumberofTraffic);
+		//Precondition: TypeFlag has been assigned
+		//Postcondition: The same as load, but the file is read by ifstream one number at a time, which is the baseline of load
+
+		const VONERequest::RequestTable& get_request() const;
+		//Postcondition: Return the table of the loaded requests
+
+		friend ostream& operator <<(ostream& outs, const TrafficLoader& Loader);
+		//Precondition: outs has been connected to an out stream
+		//Postcondition: Print the statistics of the loading to outs
+
+		~TrafficLoader();
+
+	private:
+		VONERequest::RequestTable _request;
+
+		//Statistics of the loading, the time is the wall time in ms:
+		long long _parsed_bytes;
+		double _load_time;
+	};
+}
@@ -0,0 +1,635 @@
+//This file defines class PathFinder and PathCache
+//------------------------------------------------
+//File Name: Path.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#include "Path.h"
+
+#include <queue>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+namespace
+{
+	bool less_path(const VONEPath::Path& FirstPath, const VONEPath::Path& SecondPath);
+	//Postcondition: Return true if FirstPath has less hops than SecondPath, paths with the same hops are compared by their vertexes
+
+	long long getPairKey(const int Source, const int Destination);
+	//Postcondition: Return the key of the ordered vertex pair from Source to Destination
+
+	//The header of a path table, which is followed by uint64_t keys of the pairs in ascending order, uint32_t first paths of the
+	//    pairs (one more for the end), uint32_t first vertexes of the paths (one more for the end), and int32_t vertexes, links and
+	//    directions. A path of n vertexes has n - 1 links, so the first link of the path p is its first vertex minus p
+	struct PathTableHeader
+	{
+		char _magic[8];
+		uint32_t _version;
+		uint32_t _k;
+		uint64_t _topology_key;
+		uint64_t _pair_number;
+		uint64_t _path_number;
+		uint64_t _vertex_number;
+	};
+
+	const char PathTableMagic[8] = { 'V', 'O', 'N', 'E', 'P', 'A', 'T', 'H' };
+	const uint32_t PathTableVersion = 1;
+
+	//The arrays of a mapped path table
+	struct PathTableView
+	{
+		uint64_t _pair_number;
+		uint64_t _path_number;
+		uint64_t _vertex_number;
+		const uint64_t* _pair_key;
+		const uint32_t* _pair_path;
+		const uint32_t* _path_vertex;
+		const int32_t* _vertex;
+		const int32_t* _link;
+		const int32_t* _direction;
+	};
+
+	unsigned long long getTopologyKey(const VONETopo::Topo& Topology, const vector<double>& Link_Length);
+	//Postcondition: Return the FNV-1a hash of the vertex number, the links and the lengths of the links, so a table is not used
+	//    after the links or their lengths are changed
+
+	bool getTableView(const VONELoader::MappedFile& Table, const unsigned long long Topology_Key, const int K, PathTableView& View);
+	//Postcondition: Return false if Table is not a path table of this version, Topology_Key and K, or its size does not fit its
+	//    header, otherwise View points to its arrays
+
+	bool findTablePaths(const PathTableView& View, const long long Pair_Key, const VONEPath::PathFinder& Finder,
+		VONEPath::PathList& Paths);
+	//Postcondition: Return false if the pair is not in the table, its offsets are out of the arrays or one of its paths is not a
+	//    path of the topology of Finder between the pair, otherwise Paths holds its paths
+}
+
+namespace VONEPath
+{
+	PathFinder::PathFinder(const VONETopo::Topo& Topology)
+	{
+		VONETopo::NodeList Vertexes;
+		Topology.get_vertex(Vertexes);
+		Topology.get_edge(_edge);
+		_vertex_num = static_cast<int>(Vertexes.size());
+
+		_adjacent_link.resize(_vertex_num);
+		for (VONETopo::LinkListIT LinkIT = _edge.begin(); LinkIT != _edge.end(); LinkIT++)
+		{
+			int link_index = static_cast<int>(LinkIT - _edge.begin() + 1);
+			_adjacent_link[LinkIT->_edge_source._vertex_id - 1].push_back(link_index);
+			_adjacent_link[LinkIT->_edge_destination._vertex_id - 1].push_back(link_index);
+		}
+	}
+
+	PathFinder::PathFinder(const VONETopo::Topo& Topology, const vector<double>& Link_Length) :PathFinder(Topology)
+	{
+		_link_length = Link_Length;
+	}
+
+	void PathFinder::get_k_shortest_paths(const int Source, const int Destination, const int K, PathList& Paths) const
+	{
+		Paths.clear();
+		vector<bool> Removed_Vertex(_vertex_num, false);
+		vector<bool> Removed_Link(_edge.size(), false);
+		Path First_Path;
+		if ((K <= 0) || !get_shortest_path(Source, Destination, Removed_Vertex, Removed_Link, First_Path))
+		{
+			return;
+		}
+		Paths.push_back(First_Path);
+
+		PathList Candidate_Paths;
+		for (int k = 1; k < K; k++)
+		{
+			Path Last_Path = Paths[k - 1];
+			for (size_t i = 0; i + 1 < Last_Path._vertex.size(); i++)
+			{
+				//The root path is the first i hops of the last path, the spur path leaves it at the vertex Last_Path._vertex[i]:
+				fill(Removed_Vertex.begin(), Removed_Vertex.end(), false);
+				fill(Removed_Link.begin(), Removed_Link.end(), false);
+				for (PathListIT PathIT = Paths.begin(); PathIT != Paths.end(); PathIT++)
+				{
+					if ((PathIT->_vertex.size() > i + 1)
+						&& equal(Last_Path._vertex.begin(), Last_Path._vertex.begin() + i + 1, PathIT->_vertex.begin()))
+					{
+						Removed_Link[PathIT->_link[i] - 1] = true;
+					}
+				}
+				for (size_t j = 0; j < i; j++)
+				{
+					Removed_Vertex[Last_Path._vertex[j] - 1] = true;
+				}
+
+				Path Spur_Path;
+				if (!get_shortest_path(Last_Path._vertex[i], Destination, Removed_Vertex, Removed_Link, Spur_Path))
+				{
+					continue;
+				}
+
+				Path Total_Path;
+				Total_Path._vertex.assign(Last_Path._vertex.begin(), Last_Path._vertex.begin() + i);
+				Total_Path._link.assign(Last_Path._link.begin(), Last_Path._link.begin() + i);
+				Total_Path._direction.assign(Last_Path._direction.begin(), Last_Path._direction.begin() + i);
+				Total_Path._vertex.insert(Total_Path._vertex.end(), Spur_Path._vertex.begin(), Spur_Path._vertex.end());
+				Total_Path._link.insert(Total_Path._link.end(), Spur_Path._link.begin(), Spur_Path._link.end());
+				Total_Path._direction.insert(Total_Path._direction.end(), Spur_Path._direction.begin(), Spur_Path._direction.end());
+
+				bool Existed = false;
+				for (PathListIT PathIT = Candidate_Paths.begin(); (PathIT != Candidate_Paths.end()) && !Existed; PathIT++)
+				{
+					Existed = (PathIT->_vertex == Total_Path._vertex);
+				}
+				for (PathListIT PathIT = Paths.begin(); (PathIT != Paths.end()) && !Existed; PathIT++)
+				{
+					Existed = (PathIT->_vertex == Total_Path._vertex);
+				}
+				if (!Existed)
+				{
+					Candidate_Paths.push_back(Total_Path);
+				}
+			}
+
+			if (Candidate_Paths.empty())
+			{
+				break;
+			}
+			PathList::iterator Best = Candidate_Paths.begin();
+			for (PathList::iterator PathIT = Candidate_Paths.begin() + 1; PathIT != Candidate_Paths.end(); PathIT++)
+			{
+				double Length = get_length(*PathIT), Best_Length = get_length(*Best);
+				if ((Length < Best_Length) || ((Length == Best_Length) && less_path(*PathIT, *Best)))
+				{
+					Best = PathIT;
+				}
+			}
+			Paths.push_back(*Best);
+			Candidate_Paths.erase(Best);
+		}
+	}
+
+	bool PathFinder::get_shortest_path(const int Source, const int Destination, const vector<bool>& Removed_Vertex,
+		const vector<bool>& Removed_Link, Path& Shortest_Path) const
+	{
+		vector<int> Previous_Link(_vertex_num, 0);
+		vector<bool> Visited(_vertex_num, false);
+		if (!_link_length.empty())
+		{
+			//Dijkstra's algorithm, a vertex is visited when it leaves the queue with its shortest distance:
+			vector<double> Distance(_vertex_num, -1);
+			priority_queue<pair<double, int>, vector<pair<double, int> >, greater<pair<double, int> > > Distance_Queue;
+			Distance[Source - 1] = 0;
+			Distance_Queue.push(make_pair(0.0, Source));
+			while (!Distance_Queue.empty() && !Visited[Destination - 1])
+			{
+				int s = Distance_Queue.top().second;
+				Distance_Queue.pop();
+				if (Visited[s - 1])
+				{
+					continue;
+				}
+				Visited[s - 1] = true;
+				for (vector<int>::const_iterator LinkIT = _adjacent_link[s - 1].begin(); LinkIT != _adjacent_link[s - 1].end(); LinkIT++)
+				{
+					const VONETopo::Edge& Link = _edge[*LinkIT - 1];
+					int d = (Link._edge_source._vertex_id == s) ? Link._edge_destination._vertex_id : Link._edge_source._vertex_id;
+					double d_Distance = Distance[s - 1] + _link_length[*LinkIT - 1];
+					if (!Visited[d - 1] && !Removed_Vertex[d - 1] && !Removed_Link[*LinkIT - 1]
+						&& ((Distance[d - 1] < 0) || (d_Distance < Distance[d - 1])))
+					{
+						Distance[d - 1] = d_Distance;
+						Previous_Link[d - 1] = *LinkIT;
+						Distance_Queue.push(make_pair(d_Distance, d));
+					}
+				}
+			}
+		}
+
+		queue<int> Vertex_Queue;
+		Visited[Source - 1] = true;
+		Vertex_Queue.push(Source);
+		while (_link_length.empty() && !Vertex_Queue.empty() && !Visited[Destination - 1])
+		{
+			int s = Vertex_Queue.front();
+			Vertex_Queue.pop();
+			for (vector<int>::const_iterator LinkIT = _adjacent_link[s - 1].begin(); LinkIT != _adjacent_link[s - 1].end(); LinkIT++)
+			{
+				const VONETopo::Edge& Link = _edge[*LinkIT - 1];
+				int d = (Link._edge_source._vertex_id == s) ? Link._edge_destination._vertex_id : Link._edge_source._vertex_id;
+				if (!Visited[d - 1] && !Removed_Vertex[d - 1] && !Removed_Link[*LinkIT - 1])
+				{
+					Visited[d - 1] = true;
+					Previous_Link[d - 1] = *LinkIT;
+					Vertex_Queue.push(d);
+				}
+			}
+		}
+
+		if (!Visited[Destination - 1])
+		{
+			return false;
+		}
+
+		Shortest_Path._vertex.assign(1, Destination);
+		Shortest_Path._link.clear();
+		Shortest_Path._direction.clear();
+		for (int d = Destination; d != Source;)
+		{
+			const VONETopo::Edge& Link = _edge[Previous_Link[d - 1] - 1];
+			int s = (Link._edge_source._vertex_id == d) ? Link._edge_destination._vertex_id : Link._edge_source._vertex_id;
+			Shortest_Path._vertex.push_back(s);
+			Shortest_Path._link.push_back(Previous_Link[d - 1]);
+			Shortest_Path._direction.push_back(Link._edge_source._vertex_id == s ? 0 : 1);
+			d = s;
+		}
+		reverse(Shortest_Path._vertex.begin(), Shortest_Path._vertex.end());
+		reverse(Shortest_Path._link.begin(), Shortest_Path._link.end());
+		reverse(Shortest_Path._direction.begin(), Shortest_Path._direction.end());
+
+		return true;
+	}
+
+	double PathFinder::get_length(const Path& Route) const
+	{
+		if (_link_length.empty())
+		{
+			return static_cast<double>(Route._link.size());
+		}
+
+		double Length = 0;
+		for (vector<int>::const_iterator LinkIT = Route._link.begin(); LinkIT != Route._link.end(); LinkIT++)
+		{
+			Length += _link_length[*LinkIT - 1];
+		}
+		return Length;
+	}
+
+	bool PathFinder::is_path(const int Source, const int Destination, const Path& Route) const
+	{
+		if (Route._vertex.empty() || (Route._vertex.front() != Source) || (Route._vertex.back() != Destination)
+			|| (Route._link.size() + 1 != Route._vertex.size()) || (Route._direction.size() != Route._link.size()))
+		{
+			return false;
+		}
+		for (size_t i = 0; i < Route._vertex.size(); i++)
+		{
+			if ((Route._vertex[i] < 1) || (Route._vertex[i] > _vertex_num))
+			{
+				return false;
+			}
+		}
+		for (size_t i = 0; i < Route._link.size(); i++)
+		{
+			if ((Route._link[i] < 1) || (Route._link[i] > static_cast<int>(_edge.size())) || (Route._direction[i] < 0)
+				|| (Route._direction[i] > 1))
+			{
+				return false;
+			}
+			const VONETopo::Edge& Link = _edge[Route._link[i] - 1];
+			int From = Route._direction[i] == 0 ? Link._edge_source._vertex_id : Link._edge_destination._vertex_id;
+			int To = Route._direction[i] == 0 ? Link._edge_destination._vertex_id : Link._edge_source._vertex_id;
+			if ((From != Route._vertex[i]) || (To != Route._vertex[i + 1]))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+
+	PathFinder::~PathFinder()
+	{
+
+	}
+
+	PathCache::PathCache(const VONETopo::Topo& Topology, const int K, const vector<double>& Link_Length) :_finder(Topology, Link_Length),
+		_k(K), _topology_key(getTopologyKey(Topology, Link_Length)), _lookup_number(0), _hit_number(0), _table_pair_number(0),
+		_computed_pair_number(0), _thread_number(0), _compute_time(0), _table_saved(false)
+	{
+		_table._data = NULL;
+		_table._size = 0;
+		_table._file = NULL;
+		_table._mapping = NULL;
+	}
+
+	void PathCache::compute(const VONERequest::RequestTable& Requests, const int Thread_Number)
+	{
+		chrono::steady_clock::time_point compute_start = chrono::steady_clock::now();
+		PathTableView View;
+		bool Table_Mapped = getTableView(_table, _topology_key, _k, View);
+
+		//The new pairs in the mapped table are read from it, the others are left to compute at their positions in the cache:
+		vector<pair<int, int> > New_Pairs;
+		vector<int> New_Position;
+		for (size_t r = 1; r <= Requests.size(); r++)
+		{
+			int Source = Requests.get_source(r - 1), Destination = Requests.get_destination(r - 1);
+			long long Key = getPairKey(Source, Destination);
+			_lookup_number++;
+			if (!_pair_position.emplace(Key, static_cast<int>(_paths.size())).second)
+			{
+				_hit_number++;
+				continue;
+			}
+
+			_paths.push_back(PathList());
+			if (Table_Mapped && findTablePaths(View, Key, _finder, _paths.back()))
+			{
+				_table_pair_number++;
+				continue;
+			}
+			New_Pairs.push_back(make_pair(Source, Destination));
+			New_Position.push_back(static_cast<int>(_paths.size()) - 1);
+		}
+
+		//Each pair is written by the thread which takes it, so the paths are not locked:
+		int Pair_Number = static_cast<int>(New_Pairs.size());
+		_computed_pair_number += Pair_Number;
+		if (Pair_Number > 0)
+		{
+			_thread_number = Thread_Number > 0 ? Thread_Number : static_cast<int>(thread::hardware_concurrency());
+			_thread_number = max(min(_thread_number, Pair_Number), 1);
+			atomic<int> Next_Pair(0);
+			vector<thread> Workers;
+			for (int t = 0; t < _thread_number; t++)
+			{
+				Workers.push_back(thread([&]()
+				{
+					for (int i = Next_Pair++; i < Pair_Number; i = Next_Pair++)
+					{
+						_finder.get_k_shortest_paths(New_Pairs[i].first, New_Pairs[i].second, _k, _paths[New_Position[i]]);
+					}
+				}));
+			}
+			for (vector<thread>::iterator WorkerIT = Workers.begin(); WorkerIT != Workers.end(); WorkerIT++)
+			{
+				WorkerIT->join();
+			}
+		}
+		_compute_time += chrono::duration<double, milli>(chrono::steady_clock::now() - compute_start).count();
+	}
+
+	void PathCache::compute(const VONERequest::RequestTable& Requests, const int Thread_Number, const string& TableFileName)
+	{
+		if (TableFileName.empty())
+		{
+			compute(Requests, Thread_Number);
+			return;
+		}
+
+		//The paths of another k are in another table, so the runs of different k do not overwrite the table of each other:
+		_table_name = TableFileName + ".k" + to_string(_k);
+		load_table(_table_name);
+		long long Computed_Pair_Number = _computed_pair_number;
+		compute(Requests, Thread_Number);
+		if (_computed_pair_number > Computed_Pair_Number)
+		{
+			_table_saved = save_table(_table_name);
+		}
+	}
+
+	bool PathCache::load_table(const string& TableFileName)
+	{
+		VONELoader::unmap_file(_table);
+		PathTableView View;
+		if (!VONELoader::map_file(TableFileName, _table) || !getTableView(_table, _topology_key, _k, View))
+		{
+			VONELoader::unmap_file(_table);
+			return false;
+		}
+		return true;
+	}
+
+	bool PathCache::save_table(const string& TableFileName)
+	{
+		//The pairs of the mapped table which are not in the cache are kept:
+		vector<pair<long long, const PathList*> > Pairs;
+		for (unordered_map<long long, int>::const_iterator PairIT = _pair_position.begin(); PairIT != _pair_position.end(); PairIT++)
+		{
+			Pairs.push_back(make_pair(PairIT->first, &_paths[PairIT->second]));
+		}
+		PathTableView View;
+		vector<PathList> Table_Paths;
+		if (getTableView(_table, _topology_key, _k, View))
+		{
+			Table_Paths.resize(static_cast<size_t>(View._pair_number));
+			for (uint64_t i = 0; i < View._pair_number; i++)
+			{
+				long long Key = static_cast<long long>(View._pair_key[i]);
+				if ((_pair_position.find(Key) == _pair_position.end()) && findTablePaths(View, Key, _finder, Table_Paths[i]))
+				{
+					Pairs.push_back(make_pair(Key, &Table_Paths[i]));
+				}
+			}
+		}
+		sort(Pairs.begin(), Pairs.end());
+
+		PathTableHeader Header;
+		memcpy(Header._magic, PathTableMagic, sizeof(Header._magic));
+		Header._version = PathTableVersion;
+		Header._k = static_cast<uint32_t>(_k);
+		Header._topology_key = _topology_key;
+		Header._pair_number = Pairs.size();
+		vector<uint64_t> Pair_Key;
+		vector<uint32_t> Pair_Path(1, 0), Path_Vertex(1, 0);
+		vector<int32_t> Vertexes, Links, Directions;
+		for (vector<pair<long long, const PathList*> >::const_iterator PairIT = Pairs.begin(); PairIT != Pairs.end(); PairIT++)
+		{
+			Pair_Key.push_back(static_cast<uint64_t>(PairIT->first));
+			for (PathListIT PathIT = PairIT->second->begin(); PathIT != PairIT->second->end(); PathIT++)
+			{
+				Vertexes.insert(Vertexes.end(), PathIT->_vertex.begin(), PathIT->_vertex.end());
+				Links.insert(Links.end(), PathIT->_link.begin(), PathIT->_link.end());
+				Directions.insert(Directions.end(), PathIT->_direction.begin(), PathIT->_direction.end());
+				Path_Vertex.push_back(static_cast<uint32_t>(Vertexes.size()));
+			}
+			Pair_Path.push_back(static_cast<uint32_t>(Path_Vertex.size() - 1));
+		}
+		Header._path_number = Path_Vertex.size() - 1;
+		Header._vertex_number = Vertexes.size();
+
+		//The table is written beside the old one and renamed, so a failed write leaves the old table:
+		string TemporaryFileName = TableFileName + ".tmp";
+		ofstream tableoutput(TemporaryFileName.c_str(), ios::binary);
+		tableoutput.write(reinterpret_cast<const char*>(&Header), sizeof(Header));
+		tableoutput.write(reinterpret_cast<const char*>(Pair_Key.data()), Pair_Key.size() * sizeof(uint64_t));
+		tableoutput.write(reinterpret_cast<const char*>(Pair_Path.data()), Pair_Path.size() * sizeof(uint32_t));
+		tableoutput.write(reinterpret_cast<const char*>(Path_Vertex.data()), Path_Vertex.size() * sizeof(uint32_t));
+		tableoutput.write(reinterpret_cast<const char*>(Vertexes.data()), Vertexes.size() * sizeof(int32_t));
+		tableoutput.write(reinterpret_cast<const char*>(Links.data()), Links.size() * sizeof(int32_t));
+		tableoutput.write(reinterpret_cast<const char*>(Directions.data()), Directions.size() * sizeof(int32_t));
+		tableoutput.close();
+		if (tableoutput.fail())
+		{
+			remove(TemporaryFileName.c_str());
+			return false;
+		}
+
+		//A mapped file can not be replaced on Windows:
+		VONELoader::unmap_file(_table);
+		remove(TableFileName.c_str());
+		if (rename(TemporaryFileName.c_str(), TableFileName.c_str()) != 0)
+		{
+			remove(TemporaryFileName.c_str());
+			return false;
+		}
+		return load_table(TableFileName);
+	}
+
+	const PathList& PathCache::get_paths(const int Source, const int Destination) const
+	{
+		static const PathList No_Path;
+		unordered_map<long long, int>::const_iterator PairIT = _pair_position.find(getPairKey(Source, Destination));
+		return PairIT == _pair_position.end() ? No_Path : _paths[PairIT->second];
+	}
+
+	ostream& operator <<(ostream& outs, const PathCache& Cache)
+	{
+		outs << "Path Cache: Lookups = " << Cache._lookup_number << ", Vertex Pairs = " << Cache._paths.size() << ", Hit Rate = "
+			<< (Cache._lookup_number > 0 ? static_cast<double>(Cache._hit_number) / Cache._lookup_number : 0) << ", Threads = "
+			<< Cache._thread_number << ", Computing Time = " << Cache._compute_time << "ms" << endl;
+		if (!Cache._table_name.empty())
+		{
+			outs << "Path Table = " << Cache._table_name << ", Pairs Read = " << Cache._table_pair_number << ", Pairs Computed = "
+				<< Cache._computed_pair_number << ", Table Saved = " << (Cache._table_saved ? "Yes" : "No") << endl;
+		}
+		return outs;
+	}
+
+	PathCache::~PathCache()
+	{
+		VONELoader::unmap_file(_table);
+	}
+}
+
+namespace
+{
+	bool less_path(const VONEPath::Path& FirstPath, const VONEPath::Path& SecondPath)
+	{
+		if (FirstPath._link.size() != SecondPath._link.size())
+		{
+			return FirstPath._link.size() < SecondPath._link.size();
+		}
+		return FirstPath._vertex < SecondPath._vertex;
+	}
+
+	long long getPairKey(const int Source, const int Destination)
+	{
+		return (static_cast<long long>(Source) << 32) | static_cast<unsigned int>(Destination);
+	}
+
+	unsigned long long getTopologyKey(const VONETopo::Topo& Topology, const vector<double>& Link_Length)
+	{
+		VONETopo::NodeList Vertexes;
+		VONETopo::LinkList Links;
+		Topology.get_vertex(Vertexes);
+		Topology.get_edge(Links);
+		vector<unsigned long long> Words;
+		Words.push_back(Vertexes.size());
+		Words.push_back(Links.size());
+		for (VONETopo::LinkListIT LinkIT = Links.begin(); LinkIT != Links.end(); LinkIT++)
+		{
+			Words.push_back(static_cast<unsigned long long>(LinkIT->_edge_id));
+			Words.push_back(static_cast<unsigned long long>(LinkIT->_edge_source._vertex_id));
+			Words.push_back(static_cast<unsigned long long>(LinkIT->_edge_destination._vertex_id));
+		}
+		Words.push_back(Link_Length.size());
+		for (vector<double>::const_iterator LengthIT = Link_Length.begin(); LengthIT != Link_Length.end(); LengthIT++)
+		{
+			unsigned long long Bits;
+			memcpy(&Bits, &*LengthIT, sizeof(Bits));
+			Words.push_back(Bits);
+		}
+
+		unsigned long long Key = 14695981039346656037ULL;
+		const unsigned char* Bytes = reinterpret_cast<const unsigned char*>(Words.data());
+		for (size_t i = 0; i < Words.size() * sizeof(unsigned long long); i++)
+		{
+			Key = (Key ^ Bytes[i]) * 1099511628211ULL;
+		}
+		return Key;
+	}
+
+	bool getTableView(const VONELoader::MappedFile& Table, const unsigned long long Topology_Key, const int K, PathTableView& View)
+	{
+		if ((Table._data == NULL) || (Table._size < sizeof(PathTableHeader)))
+		{
+			return false;
+		}
+		const PathTableHeader* Header = reinterpret_cast<const PathTableHeader*>(Table._data);
+		if ((memcmp(Header->_magic, PathTableMagic, sizeof(PathTableMagic)) != 0) || (Header->_version != PathTableVersion)
+			|| (Header->_k != static_cast<uint32_t>(K)) || (Header->_topology_key != Topology_Key))
+		{
+			return false;
+		}
+
+		//The counts are checked against the file size before they are multiplied, so a damaged header does not overflow:
+		uint64_t Size = Table._size;
+		if ((Header->_pair_number > Size) || (Header->_path_number > Size) || (Header->_vertex_number > Size)
+			|| (Header->_vertex_number < Header->_path_number))
+		{
+			return false;
+		}
+		uint64_t Link_Number = Header->_vertex_number - Header->_path_number;
+		if (sizeof(PathTableHeader) + Header->_pair_number * sizeof(uint64_t) + (Header->_pair_number + 1) * sizeof(uint32_t)
+			+ (Header->_path_number + 1) * sizeof(uint32_t) + (Header->_vertex_number + 2 * Link_Number) * sizeof(int32_t) != Size)
+		{
+			return false;
+		}
+
+		View._pair_number = Header->_pair_number;
+		View._path_number = Header->_path_number;
+		View._vertex_number = Header->_vertex_number;
+		View._pair_key = reinterpret_cast<const uint64_t*>(Table._data + sizeof(PathTableHeader));
+		View._pair_path = reinterpret_cast<const uint32_t*>(View._pair_key + View._pair_number);
+		View._path_vertex = View._pair_path + View._pair_number + 1;
+		View._vertex = reinterpret_cast<const int32_t*>(View._path_vertex + View._path_number + 1);
+		View._link = View._vertex + View._vertex_number;
+		View._direction = View._link + Link_Number;
+		return true;
+	}
+
+	bool findTablePaths(const PathTableView& View, const long long Pair_Key, const VONEPath::PathFinder& Finder,
+		VONEPath::PathList& Paths)
+	{
+		const uint64_t* Key = lower_bound(View._pair_key, View._pair_key + View._pair_number, static_cast<uint64_t>(Pair_Key));
+		if ((Key == View._pair_key + View._pair_number) || (*Key != static_cast<uint64_t>(Pair_Key)))
+		{
+			return false;
+		}
+
+		uint64_t i = Key - View._pair_key;
+		uint32_t First_Path = View._pair_path[i], Last_Path = View._pair_path[i + 1];
+		if ((First_Path > Last_Path) || (Last_Path > View._path_number))
+		{
+			return false;
+		}
+		Paths.resize(Last_Path - First_Path);
+		for (uint32_t p = First_Path; p < Last_Path; p++)
+		{
+			uint32_t First_Vertex = View._path_vertex[p], Last_Vertex = View._path_vertex[p + 1];
+			if ((First_Vertex < p) || (First_Vertex >= Last_Vertex) || (Last_Vertex > View._vertex_number)
+				|| (Last_Vertex - p - 1 > View._vertex_number - View._path_number))
+			{
+				return false;
+			}
+			VONEPath::Path& Route = Paths[p - First_Path];
+			Route._vertex.assign(View._vertex + First_Vertex, View._vertex + Last_Vertex);
+			Route._link.assign(View._link + First_Vertex - p, View._link + Last_Vertex - p - 1);
+			Route._direction.assign(View._direction + First_Vertex - p, View._direction + Last_Vertex - p - 1);
+
+			//The vertexes and links index into the topology later, so a damaged table must not hold ids out of it:
+			if (!Finder.is_path(static_cast<int>(Pair_Key >> 32), static_cast<int>(Pair_Key & 0xFFFFFFFF), Route))
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
@@ -0,0 +1,138 @@
+//This file declares class PathFinder and PathCache
+//------------------------------------------------
+//File Name: Path.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include "Topo.h"
+#include "Request.h"
+#include "Loader.h"
+#include <unordered_map>
+
+namespace VONEPath
+{
+	//A loopless path in the substrate network. _link[i] is the index (starting from 1) in the LinkList of the link from
+	//    _vertex[i] to _vertex[i + 1], and _direction[i] is 0 if the link is passed from its source to its destination, or 1 reversely
+	struct Path
+	{
+		vector<int> _vertex;
+		vector<int> _link;
+		vector<int> _direction;
+	};
+
+	typedef vector<Path> PathList;
+	typedef PathList::const_iterator PathListIT;
+
+	//Compute the k shortest loopless paths between two vertexes of the substrate network by Yen's algorithm, the paths are the
+	//    shortest in hops, or in length if the lengths of the links are given
+	class PathFinder
+	{
+	public:
+		PathFinder(const VONETopo::Topo& Topology);
+		//Precondition: The topology has been assigned and its vertex IDs are from 1 to the number of vertexes
+		//Postcondition: The adjacent links of every vertex have been recorded
+
+		PathFinder(const VONETopo::Topo& Topology, const vector<double>& Link_Length);
+		//Precondition: The topology has been assigned and its vertex IDs are from 1 to the number of vertexes, Link_Length[i] is the
+		//    positive length of the link i + 1 of the LinkList or Link_Length is empty for the hop metric
+		//Postcondition: The adjacent links of every vertex and the lengths of the links have been recorded
+
+		void get_k_shortest_paths(const int Source, const int Destination, const int K, PathList& Paths) const;
+		//Precondition: Source and Destination are two different vertexes of the topology
+		//Postcondition: Paths holds at most K loopless paths from Source to Destination in the order of the length (the hop number
+		//    for the hop metric), the paths of the same length are in the order of the hop number and then their vertexes
+
+		double get_length(const Path& Route) const;
+		//Postcondition: Return the sum of the lengths of the links of Route, or its hop number for the hop metric
+
+		bool is_path(const int Source, const int Destination, const Path& Route) const;
+		//Postcondition: Return true if Route goes from Source to Destination over vertexes of the topology, and each of its links
+		//    joins its two vertexes in its direction
+
+		~PathFinder();
+
+	private:
+		bool get_shortest_path(const int Source, const int Destination, const vector<bool>& Removed_Vertex,
+			const vector<bool>& Removed_Link, Path& Shortest_Path) const;
+		//Precondition: The vertexes and links marked in Removed_Vertex and Removed_Link can not be passed
+		//Postcondition: Return false if Destination can not be reached, otherwise Shortest_Path is the path with the least hops,
+		//    or the least length by Dijkstra's algorithm if the lengths of the links are given
+
+		int _vertex_num;
+		VONETopo::LinkList _edge;
+		vector<vector<int> > _adjacent_link;
+		vector<double> _link_length;
+	};
+
+	//The k shortest paths of the vertex pairs of the requests: the traffic files repeat the same pairs many times, so the paths of
+	//    each ordered pair are computed once, and the new pairs of a table of requests are computed in parallel. The paths can be
+	//    kept between runs in a binary path table, which is mapped into memory and read in place: it is a header (the version, k
+	//    and the key of the topology and the link lengths) followed by the sorted keys of the pairs and the offsets of their paths
+	//    into flat arrays of the vertexes, links and directions
+	class PathCache
+	{
+	public:
+		PathCache(const VONETopo::Topo& Topology, const int K, const vector<double>& Link_Length = vector<double>());
+		//Precondition: The same as PathFinder, and K is positive
+		//Postcondition: The cache is empty
+
+		void compute(const VONERequest::RequestTable& Requests, const int Thread_Number);
+		//Precondition: The vertexes of the requests are vertexes of the topology
+		//Postcondition: The paths of the vertex pairs of Requests which are not in the cache have been read from the mapped path
+		//    table or computed by Thread_Number threads (the hardware threads for 0), and added to it. Each request is a lookup of the
+		//    cache, which is a hit if its pair is in the cache before it, so the hit rate is the part of the requests whose paths are
+		//    not found again
+
+		void compute(const VONERequest::RequestTable& Requests, const int Thread_Number, const string& TableFileName);
+		//Precondition: The same as compute
+		//Postcondition: The same as compute, but the path table of k, which is TableFileName followed by ".k" and k, is loaded first
+		//    and saved again if some pairs were computed, so a missing table or a table of another topology is regenerated and the
+		//    tables of different k are kept side by side. An empty name uses no table
+
+		bool load_table(const string& TableFileName);
+		//Postcondition: Return false if the file fails to map or it is not a path table of this version, topology and k, otherwise
+		//    the table is mapped until the next table is loaded or saved. A pair whose paths are not paths of the topology is
+		//    computed again
+
+		bool save_table(const string& TableFileName);
+		//Postcondition: Return false if the file fails to be written, otherwise it holds the paths of the pairs of the cache and of
+		//    the mapped table, and it is mapped as the table
+
+		const PathList& get_paths(const int Source, const int Destination) const;
+		//Postcondition: Return the paths from Source to Destination, which are empty if the pair is not in the cache or Destination
+		//    can not be reached. The cache is not changed, so it can be read by many threads
+
+		friend ostream& operator <<(ostream& outs, const PathCache& Cache);
+		//Precondition: outs has been connected to an out stream
+		//Postcondition: Print the statistics of the cache to outs
+
+		~PathCache();
+
+	private:
+		PathCache(const PathCache& Cache);
+		PathCache& operator =(const PathCache& Cache);
+		//The mapped table is unmapped once, so the cache is not copied
+
+		PathFinder _finder;
+		int _k;
+		unsigned long long _topology_key;
+		VONELoader::MappedFile _table;
+
+		//The paths of an ordered pair are _paths[_pair_position[Key]], where the key has the source in the high 32 bits:
+		unordered_map<long long, int> _pair_position;
+		vector<PathList> _paths;
+
+		//Statistics of the cache, the time is the wall time in ms:
+		long long _lookup_number;
+		long long _hit_number;
+		long long _table_pair_number;
+		long long _computed_pair_number;
+		int _thread_number;
+		double _compute_time;
+		string _table_name;
+		bool _table_saved;
+	};
+}
@@ -0,0 +1,191 @@
+//This file defines class RequestTable and class DemandClasses
+//------------------------------------------------
+//File Name: Request.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#include "Request.h"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace VONERequest
+{
+	RequestTable::RequestTable()
+	{
+
+	}
+
+	bool RequestTable::add(const int Source, const int Destination, const int Type, const int Width)
+	{
+		if ((Source < 0) || (Source > UINT16_MAX) || (Destination < 0) || (Destination > UINT16_MAX) || (Type < 0)
+			|| (Type > UINT8_MAX) || (Width < 0) || (Width > UINT16_MAX))
+		{
+			return false;
+		}
+
+		_source.push_back(static_cast<uint16_t>(Source));
+		_destination.push_back(static_cast<uint16_t>(Destination));
+		_type.push_back(static_cast<uint8_t>(Type));
+		_width.push_back(static_cast<uint16_t>(Width));
+		return true;
+	}
+
+	void RequestTable::append(const RequestTable& Requests, const size_t First, const size_t Last)
+	{
+		_source.insert(_source.end(), Requests._source.begin() + First, Requests._source.begin() + Last);
+		_destination.insert(_destination.end(), Requests._destination.begin() + First, Requests._destination.begin() + Last);
+		_type.insert(_type.end(), Requests._type.begin() + First, Requests._type.begin() + Last);
+		_width.insert(_width.end(), Requests._width.begin() + First, Requests._width.begin() + Last);
+	}
+
+	RequestTable RequestTable::slice(const size_t First, const size_t Last) const
+	{
+		RequestTable Requests;
+		Requests.append(*this, First, Last);
+		return Requests;
+	}
+
+	void RequestTable::reserve(const size_t Request_Number)
+	{
+		_source.reserve(Request_Number);
+		_destination.reserve(Request_Number);
+		_type.reserve(Request_Number);
+		_width.reserve(Request_Number);
+	}
+
+	void RequestTable::clear()
+	{
+		_source.clear();
+		_destination.clear();
+		_type.clear();
+		_width.clear();
+	}
+
+	size_t RequestTable::size() const
+	{
+		return _source.size();
+	}
+
+	bool RequestTable::empty() const
+	{
+		return _source.empty();
+	}
+
+	size_t RequestTable::get_bytes() const
+	{
+		return size() * (sizeof(uint16_t) * 3 + sizeof(uint8_t));
+	}
+
+	int RequestTable::get_source(const size_t Request) const
+	{
+		return _source[Request];
+	}
+
+	int RequestTable::get_destination(const size_t Request) const
+	{
+		return _destination[Request];
+	}
+
+	int RequestTable::get_type(const size_t Request) const
+	{
+		return _type[Request];
+	}
+
+	int RequestTable::get_width(const size_t Request) const
+	{
+		return _width[Request];
+	}
+
+	ostream& operator <<(ostream& outs, const RequestTable& Requests)
+	{
+		outs << left << setw(10) << "Request" << setw(10) << "Source" << setw(15) << "Destination" << setw(10) << "Type"
+			<< setw(10) << "Slots" << endl;
+
+		for (size_t r = 1; r <= Requests.size(); r++)
+		{
+			outs << left << setw(10) << r << setw(10) << Requests._source[r - 1] << setw(15) << Requests._destination[r - 1]
+				<< setw(10) << static_cast<int>(Requests._type[r - 1]) << setw(10) << Requests._width[r - 1] << endl;
+		}
+
+		return outs;
+	}
+
+	RequestTable::~RequestTable()
+	{
+
+	}
+
+	DemandClasses::DemandClasses()
+	{
+
+	}
+
+	void DemandClasses::assign(const RequestTable& Requests)
+	{
+		_class.assign(Requests.size(), 0);
+		_previous.assign(Requests.size(), -1);
+		_multiplicity.clear();
+
+		//A request is 56 bits in the columns, so the key is exact. Last[c] is the last request of the class c so far:
+		unordered_map<uint64_t, int> Class_Position;
+		vector<int> Last;
+		for (size_t r = 0; r < Requests.size(); r++)
+		{
+			uint64_t Key = (static_cast<uint64_t>(Requests.get_source(r)) << 40) | (static_cast<uint64_t>(Requests.get_destination(r)) << 24)
+				| (static_cast<uint64_t>(Requests.get_type(r)) << 16) | static_cast<uint64_t>(Requests.get_width(r));
+			pair<unordered_map<uint64_t, int>::iterator, bool> Result =
+				Class_Position.insert(make_pair(Key, static_cast<int>(_multiplicity.size())));
+			int Class = Result.first->second;
+			if (Result.second)
+			{
+				_multiplicity.push_back(0);
+				Last.push_back(-1);
+			}
+
+			_class[r] = Class;
+			_previous[r] = Last[Class];
+			_multiplicity[Class]++;
+			Last[Class] = static_cast<int>(r);
+		}
+	}
+
+	size_t DemandClasses::size() const
+	{
+		return _multiplicity.size();
+	}
+
+	int DemandClasses::get_class(const size_t Request) const
+	{
+		return _class[Request];
+	}
+
+	int DemandClasses::get_previous(const size_t Request) const
+	{
+		return _previous[Request];
+	}
+
+	int DemandClasses::get_multiplicity(const size_t Class) const
+	{
+		return _multiplicity[Class];
+	}
+
+	ostream& operator <<(ostream& outs, const DemandClasses& Classes)
+	{
+		int Largest_Multiplicity = 0;
+		for (vector<int>::const_iterator ClassIT = Classes._multiplicity.begin(); ClassIT != Classes._multiplicity.end(); ClassIT++)
+		{
+			Largest_Multiplicity = max(Largest_Multiplicity, *ClassIT);
+		}
+		outs << "Demand Classes = " << Classes.size() << " of " << Classes._class.size() << " Requests, Largest Multiplicity = "
+			<< Largest_Multiplicity << ", Duplicate Requests = " << Classes._class.size() - Classes.size() << endl;
+		return outs;
+	}
+
+	DemandClasses::~DemandClasses()
+	{
+
+	}
+}
@@ -0,0 +1,110 @@
+//This file declares class RequestTable and class DemandClasses
+//------------------------------------------------
+//File Name: Request.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+using namespace std;
+
+namespace VONERequest
+{
+	//The requests of a traffic file, each is a virtual edge of the width in slots from the source to the destination substrate
+	//    vertex. The columns are kept in separate arrays of the narrowest types of the traffic files, so a request takes 7 bytes
+	//    and the engines reading one column only load that column. The requests are indexed from 0 like a vector
+	class RequestTable
+	{
+	public:
+		RequestTable();
+
+		bool add(const int Source, const int Destination, const int Type, const int Width);
+		//Postcondition: Return false if a value is out of the range of its column (0 to 65535 for the vertexes and the width,
+		//    0 to 255 for the type), otherwise the request is appended to the table
+
+		void append(const RequestTable& Requests, const size_t First, const size_t Last);
+		//Precondition: First <= Last <= Requests.size()
+		//Postcondition: The requests of Requests from First to Last - 1 are appended to the table
+
+		RequestTable slice(const size_t First, const size_t Last) const;
+		//Precondition: First <= Last <= size()
+		//Postcondition: Return a table of the requests from First to Last - 1
+
+		void reserve(const size_t Request_Number);
+		//Postcondition: The columns have the memory of Request_Number requests
+
+		void clear();
+		//Postcondition: The table is empty
+
+		size_t size() const;
+		//Postcondition: Return the number of the requests
+
+		bool empty() const;
+		//Postcondition: Return true if there are no requests
+
+		size_t get_bytes() const;
+		//Postcondition: Return the bytes of the requests in the columns
+
+		int get_source(const size_t Request) const;
+		int get_destination(const size_t Request) const;
+		int get_type(const size_t Request) const;
+		int get_width(const size_t Request) const;
+		//Precondition: Request < size()
+		//Postcondition: Return the column of the request
+
+		friend ostream& operator <<(ostream& outs, const RequestTable& Requests);
+		//Precondition: outs should be connected to the screen or a file
+		//Postcondition: The requests will be showed
+
+		~RequestTable();
+
+	private:
+		vector<uint16_t> _source;
+		vector<uint16_t> _destination;
+		vector<uint8_t> _type;
+		vector<uint16_t> _width;
+	};
+
+	//The identical requests of a request table, which have the same source, destination, type and width, grouped into classes.
+	//    The classes are numbered from 0 in the order of their first request, and the requests of a class are in their order
+	class DemandClasses
+	{
+	public:
+		DemandClasses();
+
+		void assign(const RequestTable& Requests);
+		//Postcondition: The requests of Requests are grouped into the classes of the identical requests
+
+		size_t size() const;
+		//Postcondition: Return the number of the classes
+
+		int get_class(const size_t Request) const;
+		//Precondition: Request is less than the number of the requests of assign
+		//Postcondition: Return the class of the request
+
+		int get_previous(const size_t Request) const;
+		//Precondition: The same as get_class
+		//Postcondition: Return the last request before Request in its class, or -1 if it is the first one
+
+		int get_multiplicity(const size_t Class) const;
+		//Precondition: Class < size()
+		//Postcondition: Return the number of the requests of the class
+
+		friend ostream& operator <<(ostream& outs, const DemandClasses& Classes);
+		//Precondition: outs has been connected to an out stream
+		//Postcondition: Print the number of the classes and the requests in them to outs
+
+		~DemandClasses();
+
+	private:
+		vector<int> _class;
+		vector<int> _previous;
+		vector<int> _multiplicity;
+	};
+}
@@ -0,0 +1,153 @@
+//This file defines class VONERolling
+//------------------------------------------------
+//File Name: Rolling.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#ifndef VONE_NO_CPLEX
+#include "Rolling.h"
+
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+
+namespace VONERolling
+{
+	VONERolling::VONERolling() :_type_flag(0), _core_number(0), _window_size(0), _window_overlap(0), _window_number(0),
+		_failed_window_number(0), _blocked_number(0), _hop_number(0), _max_index(0), _solve_time(0), _longest_window_time(0)
+	{
+
+	}
+
+	void VONERolling::solve(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests,
+		int TypeFlag, int CoreNum, const VONEILP::ILPOption& Option)
+	{
+		chrono::steady_clock::time_point solve_start = chrono::steady_clock::now();
+		_type_flag = TypeFlag;
+		_core_number = CoreNum;
+		Substrate_Network.get_edge(_edge);
+
+		//A window must commit at least one request, so at most _window_size - 1 requests are solved again:
+		_window_size = max(Option._window_size, 1);
+		_window_overlap = min(max(Option._window_overlap, 0), _window_size - 1);
+		VONEILP::ILPOption Window_Option = Option;
+		Window_Option._path_number = 0;
+		Window_Option._export_flag = 0;
+		Window_Option._batch_size = 0;
+		if (Option._path_number > 0)
+		{
+			cerr << "The windows are only solved by the arc-flow formulation.\n";
+		}
+
+		int Request_Number = static_cast<int>(Requests.size());
+		_assignment.assign(Request_Number, vector<VONEGreedy::EdgeAssignment>());
+		_bandwidth.assign(Request_Number, 0);
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			_bandwidth[r - 1] = Requests.get_width(r - 1);
+		}
+
+		VONESpectrum::SpectrumOccupancy Occupied;
+		Occupied.assign(_edge, CoreNum);
+		_window_number = 0;
+		_failed_window_number = 0;
+		_blocked_number = 0;
+		_longest_window_time = 0;
+		for (int First = 1; First <= Request_Number;)
+		{
+			int Last = min(Request_Number, First + _window_size - 1);
+			int Committed_Last = Last == Request_Number ? Last : Last - _window_overlap;
+			VONERequest::RequestTable Window_List = Requests.slice(First - 1, Last);
+
+			chrono::steady_clock::time_point window_start = chrono::steady_clock::now();
+			VONEILP::VONECplex Window;
+			Window.solve(Substrate_Network, Window_List, TypeFlag, CoreNum, Window_Option, &Occupied);
+			vector<vector<VONEGreedy::EdgeAssignment> > Window_Assignment;
+			bool Solved = Window.get_assignment(Window_Assignment);
+			double Window_Time = chrono::duration<double, milli>(chrono::steady_clock::now() - window_start).count();
+			_longest_window_time = max(_longest_window_time, Window_Time);
+			_window_number++;
+			cout << "Window " << _window_number << ": requests " << First << " to " << Last << ", " << (Solved ? "solved" : "failed")
+				<< " in " << Window_Time << "ms" << endl;
+
+			//Only the requests before the overlap keep their resources, the others are solved again in the next window:
+			for (int r = First; r <= Committed_Last; r++)
+			{
+				if (!Solved)
+				{
+					_blocked_number++;
+					continue;
+				}
+
+				_assignment[r - 1] = Window_Assignment[r - First];
+				for (vector<VONEGreedy::EdgeAssignment>::const_iterator EdgeIT = _assignment[r - 1].begin(); EdgeIT != _assignment[r - 1].end(); EdgeIT++)
+				{
+					for (vector<VONEGreedy::LinkAssignment>::const_iterator HopIT = EdgeIT->_hop.begin(); HopIT != EdgeIT->_hop.end(); HopIT++)
+					{
+						if (TypeFlag != 0)
+						{
+							Occupied.allocate(HopIT->_link, HopIT->_direction, HopIT->_core, HopIT->_start, EdgeIT->_bandwidth);
+						}
+						for (vector<int>::const_iterator SlotIT = EdgeIT->_slot.begin(); (TypeFlag == 0) && (SlotIT != EdgeIT->_slot.end()); SlotIT++)
+						{
+							Occupied.allocate(HopIT->_link, HopIT->_direction, HopIT->_core, *SlotIT, 1);
+						}
+					}
+				}
+			}
+			_failed_window_number += Solved ? 0 : 1;
+			First = Committed_Last + 1;
+		}
+
+		//The objective of the ILP over all requests, the spectrum end index of an unused link is Omega - 1:
+		_hop_number = 0;
+		_max_index = 0;
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			if (TypeFlag != 0)
+			{
+				_max_index = max(_max_index, _bandwidth[r - 1] - 1);
+			}
+			for (vector<VONEGreedy::EdgeAssignment>::const_iterator EdgeIT = _assignment[r - 1].begin(); EdgeIT != _assignment[r - 1].end(); EdgeIT++)
+			{
+				_hop_number += static_cast<int>(EdgeIT->_hop.size());
+				for (vector<VONEGreedy::LinkAssignment>::const_iterator HopIT = EdgeIT->_hop.begin(); HopIT != EdgeIT->_hop.end(); HopIT++)
+				{
+					if (TypeFlag != 0)
+					{
+						_max_index = max(_max_index, HopIT->_start + EdgeIT->_bandwidth - 1);
+					}
+					else if (!EdgeIT->_slot.empty())
+					{
+						_max_index = max(_max_index, EdgeIT->_slot.back());
+					}
+				}
+			}
+		}
+		_solve_time = chrono::duration<double, milli>(chrono::steady_clock::now() - solve_start).count();
+	}
+
+	ostream& operator <<(ostream& outs, const VONERolling& Rolling)
+	{
+		int Request_Number = static_cast<int>(Rolling._assignment.size());
+		outs << "Windows = " << Rolling._window_number << ", Window Size = " << Rolling._window_size << ", Re-optimized Requests = "
+			<< Rolling._window_overlap << ", Failed Windows = " << Rolling._failed_window_number << endl;
+		outs << "Blocked Requests = " << Rolling._blocked_number << " of " << Request_Number << endl;
+		outs << "Solution Objective Value Maximum M = " << Rolling._max_index + Rolling._hop_number << endl;
+		outs << "Solving Time = " << Rolling._solve_time << "ms, Longest Window Time = " << Rolling._longest_window_time << "ms" << endl;
+		outs << "Solution Variables Value are following:\n";
+		outs << left << setw(30) << "Variable Name" << "Value" << endl;
+
+		VONEGreedy::print_assignment(outs, Rolling._edge, Rolling._bandwidth, Rolling._assignment, Rolling._type_flag);
+		outs << "Ms = " << Rolling._max_index << endl;
+		return outs;
+	}
+
+	VONERolling::~VONERolling()
+	{
+
+	}
+}
+#endif
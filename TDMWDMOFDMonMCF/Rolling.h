@@ -0,0 +1,54 @@
+//This file declares class VONERolling
+//------------------------------------------------
+//File Name: Rolling.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include "ILP.h"
+
+namespace VONERolling
+{
+	//Solve the ILP of the requests window by window in their order: the links, cores and spectrum (or time slots) of the requests of
+	//    the earlier windows are fixed as occupied slots, and the last _window_overlap requests of a window are solved again in the
+	//    next window with the new requests
+	class VONERolling
+	{
+	public:
+		VONERolling();
+
+		void solve(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests, int TypeFlag, int CoreNum,
+			const VONEILP::ILPOption& Option);
+		//Precondition: Topology of substrate netwrok and the requests have been assigned, TypeFlag has been assigned, CoreNum
+		//    has been given and Option._window_size is positive
+		//Postcondition: The requests of Requests are solved by the arc-flow formulation of Option in windows of
+		//    Option._window_size requests, the requests of a window without a solution are blocked
+
+		friend ostream& operator <<(ostream& outs, const VONERolling& Rolling);
+		//Precondition: outs has been connected to an out stream
+		//Postcondition: Print the statistics of the windows and the solution in the same form of the ILP to outs
+
+		~VONERolling();
+
+	private:
+		int _type_flag;
+		int _core_number;
+		int _window_size;
+		int _window_overlap;
+		VONETopo::LinkList _edge;
+		vector<int> _bandwidth;
+
+		vector<vector<VONEGreedy::EdgeAssignment> > _assignment;
+		int _window_number;
+		int _failed_window_number;
+		int _blocked_number;
+		int _hop_number;
+		int _max_index;
+
+		//The wall times in ms:
+		double _solve_time;
+		double _longest_window_time;
+	};
+}
@@ -0,0 +1,313 @@
+//This file defines class VONESimulator
+//------------------------------------------------
+//File Name: Simulator.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#include "Simulator.h"
+
+#include <algorithm>
+#include <random>
+#include <chrono>
+
+namespace
+{
+	bool later_departure(const VONESimulator::Departure& FirstDeparture, const VONESimulator::Departure& SecondDeparture);
+	//Postcondition: Return true if FirstDeparture is after SecondDeparture, so the heap of the departures keeps the earliest one
+	//    at its front
+}
+
+namespace VONESimulator
+{
+	SimulationOption::SimulationOption() :_load(0), _holding_time(1), _arrival_number(100000), _warmup_number(-1), _sample_interval(1000), _seed(1)
+	{
+
+	}
+
+	VONESimulator::VONESimulator() :_type_flag(0), _core_number(0), _link_number(0), _arrival(0), _blocked(0), _requested_slot(0),
+		_blocked_slot(0), _event_number(0), _total_slot(0), _occupied_slot(0), _occupied_slot_time(0), _observed_time(0), _fragmentation_sum(0),
+		_fragmentation_sample(0), _simulation_time(0)
+	{
+
+	}
+
+	void VONESimulator::simulate(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests,
+		int TypeFlag, int CoreNum, const SimulationOption& Option, const VONEPath::PathCache* Paths)
+	{
+		chrono::steady_clock::time_point simulation_start = chrono::steady_clock::now();
+		_type_flag = TypeFlag;
+		_core_number = CoreNum;
+		_option = Option;
+		_option._warmup_number = Option._warmup_number < 0 ? Option._arrival_number / 10 : Option._warmup_number;
+		_option._sample_interval = max(Option._sample_interval, 1);
+
+		VONETopo::LinkList Substrate_Network_Edge;
+		Substrate_Network.get_edge(Substrate_Network_Edge);
+		_occupancy.assign(Substrate_Network_Edge, CoreNum);
+		_link_number = static_cast<int>(Substrate_Network_Edge.size());
+		_total_slot = 0;
+		for (VONETopo::LinkListIT SNTopoIT = Substrate_Network_Edge.begin(); SNTopoIT != Substrate_Network_Edge.end(); SNTopoIT++)
+		{
+			_total_slot += 2LL * CoreNum * SNTopoIT->_edge_bandwidth;
+		}
+
+		//The shortest paths of the vertex pairs are found once if they are not given:
+		VONEPath::PathCache Shortest_Paths(Substrate_Network, 1);
+		if (Paths == 0)
+		{
+			Shortest_Paths.compute(Requests, 1);
+			Paths = &Shortest_Paths;
+		}
+		int Request_Number = static_cast<int>(Requests.size());
+		_request_edge.assign(1, 0);
+		_edge_path.clear();
+		_edge_bandwidth.clear();
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			//A request is one virtual edge between the substrate vertexes of its source and destination:
+			//A path without vertexes means that the destination can not be reached:
+			const VONEPath::PathList& Shortest_Path = Paths->get_paths(Requests.get_source(r - 1), Requests.get_destination(r - 1));
+			_edge_path.push_back(Shortest_Path.empty() ? VONEPath::Path() : Shortest_Path[0]);
+			_edge_bandwidth.push_back(Requests.get_width(r - 1));
+			_request_edge.push_back(static_cast<int>(_edge_path.size()));
+		}
+
+		_connection.clear();
+		_connection_slot.clear();
+		_free_connection.clear();
+		_departure.clear();
+		_arrival = 0;
+		_blocked = 0;
+		_requested_slot = 0;
+		_blocked_slot = 0;
+		_event_number = 0;
+		_occupied_slot = 0;
+		_occupied_slot_time = 0;
+		_observed_time = 0;
+		_fragmentation_sum = 0;
+		_fragmentation_sample = 0;
+
+		//The rates of the exponential distributions must be positive:
+		if (!(_option._load > 0) || !(_option._holding_time > 0))
+		{
+			cerr << "The offered load and the mean holding time of the simulation must be positive.\n";
+			_simulation_time = chrono::duration<double, milli>(chrono::steady_clock::now() - simulation_start).count();
+			return;
+		}
+		mt19937_64 Generator(_option._seed);
+		exponential_distribution<double> Interarrival_Time(_option._load / _option._holding_time);
+		exponential_distribution<double> Holding_Time(1.0 / _option._holding_time);
+		uniform_int_distribution<int> Request_Draw(1, max(Request_Number, 1));
+		double Now = 0;
+		double Next_Arrival = Interarrival_Time(Generator);
+		int Arrived = 0;
+		while ((Arrived < _option._arrival_number) && (Request_Number > 0))
+		{
+			//The departures before the next arrival are the next events:
+			double Event_Time = Next_Arrival;
+			int Departing = -1;
+			if (!_departure.empty() && (_departure.front()._time <= Next_Arrival))
+			{
+				pop_heap(_departure.begin(), _departure.end(), later_departure);
+				Event_Time = _departure.back()._time;
+				Departing = _departure.back()._connection;
+				_departure.pop_back();
+			}
+
+			_event_number++;
+			if (Arrived >= _option._warmup_number)
+			{
+				_occupied_slot_time += static_cast<double>(_occupied_slot) * (Event_Time - Now);
+				_observed_time += Event_Time - Now;
+			}
+			Now = Event_Time;
+			if (Departing >= 0)
+			{
+				release(Departing);
+				continue;
+			}
+
+			int r = Request_Draw(Generator);
+			int Connection;
+			if (_free_connection.empty())
+			{
+				Connection = static_cast<int>(_connection.size());
+				_connection.push_back(vector<VONEGreedy::EdgeAssignment>());
+				_connection_slot.push_back(0);
+				_departure.reserve(_connection.capacity());
+			}
+			else
+			{
+				Connection = _free_connection.back();
+				_free_connection.pop_back();
+			}
+
+			bool Embedded = embed(r, Connection);
+			if (Embedded)
+			{
+				Departure Next_Departure;
+				Next_Departure._time = Now + Holding_Time(Generator);
+				Next_Departure._connection = Connection;
+				_departure.push_back(Next_Departure);
+				push_heap(_departure.begin(), _departure.end(), later_departure);
+			}
+			else
+			{
+				_free_connection.push_back(Connection);
+			}
+
+			Arrived++;
+			if (Arrived > _option._warmup_number)
+			{
+				long long Request_Slot = 0;
+				for (int i = _request_edge[r - 1]; i < _request_edge[r]; i++)
+				{
+					Request_Slot += _edge_bandwidth[i];
+				}
+				_arrival++;
+				_requested_slot += Request_Slot;
+				_blocked += Embedded ? 0 : 1;
+				_blocked_slot += Embedded ? 0 : Request_Slot;
+				if (_arrival % _option._sample_interval == 0)
+				{
+					sample_fragmentation();
+				}
+			}
+			Next_Arrival = Now + Interarrival_Time(Generator);
+		}
+		_simulation_time = chrono::duration<double, milli>(chrono::steady_clock::now() - simulation_start).count();
+	}
+
+	bool VONESimulator::embed(const int Request, const int Connection)
+	{
+		vector<VONEGreedy::EdgeAssignment>& Assignment = _connection[Connection];
+		int Edge_Number = _request_edge[Request] - _request_edge[Request - 1];
+		Assignment.resize(Edge_Number);
+
+		//The vectors of the assignments are cleared but keep their memory for the next requests of the connection:
+		bool Embedded = true;
+		int e = 0;
+		for (; (e < Edge_Number) && Embedded; e++)
+		{
+			int i = _request_edge[Request - 1] + e;
+			VONEGreedy::EdgeAssignment& Edge = Assignment[e];
+			Edge._bandwidth = _edge_bandwidth[i];
+			Edge._hop.clear();
+			Edge._slot.clear();
+			Embedded = !_edge_path[i]._vertex.empty() && ((_type_flag == 0) ?
+				VONEGreedy::assign_time_slot(_occupancy, _core_number, _edge_path[i], Edge._bandwidth, _buffer, Edge) :
+				VONEGreedy::assign_spectrum(_occupancy, _core_number, _edge_path[i], Edge._bandwidth, _buffer, Edge));
+		}
+
+		if (!Embedded)
+		{
+			//The links occupied before the failure are kept in the assignments to be released:
+			for (int k = 0; k < e; k++)
+			{
+				VONEGreedy::release_assignment(_occupancy, Assignment[k], _type_flag);
+			}
+			return false;
+		}
+
+		long long Connection_Slot = 0;
+		for (vector<VONEGreedy::EdgeAssignment>::const_iterator EdgeIT = Assignment.begin(); EdgeIT != Assignment.end(); EdgeIT++)
+		{
+			Connection_Slot += static_cast<long long>(EdgeIT->_hop.size()) * EdgeIT->_bandwidth;
+		}
+		_connection_slot[Connection] = static_cast<int>(Connection_Slot);
+		_occupied_slot += Connection_Slot;
+		return true;
+	}
+
+	void VONESimulator::release(const int Connection)
+	{
+		const vector<VONEGreedy::EdgeAssignment>& Assignment = _connection[Connection];
+		for (vector<VONEGreedy::EdgeAssignment>::const_iterator EdgeIT = Assignment.begin(); EdgeIT != Assignment.end(); EdgeIT++)
+		{
+			VONEGreedy::release_assignment(_occupancy, *EdgeIT, _type_flag);
+		}
+		_occupied_slot -= _connection_slot[Connection];
+		_free_connection.push_back(Connection);
+	}
+
+	void VONESimulator::sample_fragmentation()
+	{
+		//The fragmentation of a core is 1 - (the longest free block) / (the free slots), and the full cores are skipped:
+		for (int sd = 1; sd <= _link_number; sd++)
+		{
+			for (int Direction = 0; Direction <= 1; Direction++)
+			{
+				for (int c = 1; c <= _core_number; c++)
+				{
+					int Free_Number;
+					int Largest_Block = _occupancy.get_largest_free_block(sd, Direction, c, Free_Number);
+					if (Free_Number > 0)
+					{
+						_fragmentation_sum += 1 - static_cast<double>(Largest_Block) / Free_Number;
+						_fragmentation_sample++;
+					}
+				}
+			}
+		}
+	}
+
+	double VONESimulator::get_blocking_probability() const
+	{
+		return _arrival > 0 ? static_cast<double>(_blocked) / _arrival : 0;
+	}
+
+	double VONESimulator::get_bandwidth_blocking_probability() const
+	{
+		return _requested_slot > 0 ? static_cast<double>(_blocked_slot) / _requested_slot : 0;
+	}
+
+	double VONESimulator::get_utilization() const
+	{
+		return (_observed_time > 0) && (_total_slot > 0) ? _occupied_slot_time / _observed_time / _total_slot : 0;
+	}
+
+	double VONESimulator::get_fragmentation() const
+	{
+		return _fragmentation_sample > 0 ? _fragmentation_sum / _fragmentation_sample : 0;
+	}
+
+	long long VONESimulator::get_event_number() const
+	{
+		return _event_number;
+	}
+
+	double VONESimulator::get_simulation_time() const
+	{
+		return _simulation_time;
+	}
+
+	ostream& operator <<(ostream& outs, const VONESimulator& Simulator)
+	{
+		double Event_Rate = Simulator._simulation_time > 0 ? Simulator._event_number / Simulator._simulation_time * 1000 : 0;
+		outs << "Offered Load = " << Simulator._option._load << " Erlang, Arrivals = " << Simulator._option._arrival_number
+			<< ", Warmup Arrivals = " << Simulator._option._warmup_number << ", Seed = " << Simulator._option._seed << endl;
+		outs << "Blocked Requests = " << Simulator._blocked << " of " << Simulator._arrival << ", Blocking Probability = "
+			<< Simulator.get_blocking_probability() << ", Bandwidth Blocking Probability = " 
+			<< Simulator.get_bandwidth_blocking_probability() << endl;
+		outs << "Spectrum Utilization = " << Simulator.get_utilization() << ", Fragmentation = " << Simulator.get_fragmentation()
+			<< " (" << Simulator._fragmentation_sample << " core samples)" << endl;
+		outs << "Events = " << Simulator._event_number << ", Simulation Time = " << Simulator._simulation_time
+			<< "ms, Events per Second = " << Event_Rate << endl;
+		return outs;
+	}
+
+	VONESimulator::~VONESimulator()
+	{
+
+	}
+}
+
+namespace
+{
+	bool later_departure(const VONESimulator::Departure& FirstDeparture, const VONESimulator::Departure& SecondDeparture)
+	{
+		return FirstDeparture._time > SecondDeparture._time;
+	}
+}
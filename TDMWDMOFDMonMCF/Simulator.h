@@ -0,0 +1,121 @@
+//This file declares class VONESimulator
+//------------------------------------------------
+//File Name: Simulator.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include "Greedy.h"
+
+namespace VONESimulator
+{
+	//The options of the dynamic traffic, the default values simulate no traffic
+	struct SimulationOption
+	{
+		SimulationOption();
+
+		double _load;			//The offered load in Erlang, the arrival rate of the requests is _load / _holding_time
+		double _holding_time;	//The mean holding time of the requests
+		int _arrival_number;	//The number of the arrivals which are simulated
+		int _warmup_number;		//The first arrivals which are not counted in the statistics, negative for 10% of the arrivals
+		int _sample_interval;	//The fragmentation is sampled once every _sample_interval arrivals
+		unsigned int _seed;		//The seed of the random numbers of the arrivals, holding times and requests
+	};
+
+	//A departure of the connection _connection at _time
+	struct Departure
+	{
+		double _time;
+		int _connection;
+	};
+
+	//Simulate the requests arriving as a Poisson process and holding their resources for exponential times: each arrival is
+	//    a request drawn uniformly from the request list, which is embedded by the first-fit of the greedy engine on its
+	//    shortest path or blocked, and its resources are released at its departure
+	class VONESimulator
+	{
+	public:
+		VONESimulator();
+
+		void simulate(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests, int TypeFlag,
+			int CoreNum, const SimulationOption& Option, const VONEPath::PathCache* Paths = 0);
+		//Precondition: Topology of substrate netwrok and the requests have been assigned, TypeFlag has been assigned, CoreNum
+		//    has been given and Option._load and Option._holding_time are positive
+		//Postcondition: Nothing is simulated and an error is printed if Option._load or Option._holding_time is not positive,
+		//    otherwise Option._arrival_number arrivals and their departures have been simulated, and the blocking probability,
+		//    the spectrum utilization and the fragmentation after the warmup arrivals are recorded. The shortest paths are the
+		//    first paths of Paths if it is given, which must hold the vertex pairs of Requests
+
+		double get_blocking_probability() const;
+		//Postcondition: Return the ratio of the blocked arrivals after the warmup arrivals
+
+		double get_bandwidth_blocking_probability() const;
+		//Postcondition: Return the ratio of the bandwidth of the blocked arrivals after the warmup arrivals
+
+		double get_utilization() const;
+		//Postcondition: Return the time average of the ratio of the occupied slots after the warmup arrivals
+
+		double get_fragmentation() const;
+		//Postcondition: Return the mean fragmentation of the sampled cores which are not full
+
+		long long get_event_number() const;
+		//Postcondition: Return the number of the simulated arrivals and departures
+
+		double get_simulation_time() const;
+		//Postcondition: Return the wall time of the last simulation in ms
+
+		friend ostream& operator <<(ostream& outs, const VONESimulator& Simulator);
+		//Precondition: outs has been connected to an out stream
+		//Postcondition: Print the statistics of the simulation to outs
+
+		~VONESimulator();
+
+	private:
+		bool embed(const int Request, const int Connection);
+		//Precondition: The paths of the virtual edges of the request have been found
+		//Postcondition: Return false and free its resources if a virtual edge of the request can not be embedded, otherwise
+		//    the assignments of its virtual edges are kept by the connection
+
+		void release(const int Connection);
+		//Postcondition: The resources of the connection are free
+
+		void sample_fragmentation();
+		//Postcondition: The fragmentation of all cores of all links in both directions has been added to the statistics
+
+		int _type_flag;
+		int _core_number;
+		int _link_number;
+		SimulationOption _option;
+		VONESpectrum::SpectrumOccupancy _occupancy;
+		VONEGreedy::AssignmentBuffer _buffer;
+
+		//The virtual edges of the request r are from _request_edge[r - 1] to _request_edge[r] - 1 in _edge_path and _edge_bandwidth:
+		vector<int> _request_edge;
+		vector<VONEPath::Path> _edge_path;
+		vector<int> _edge_bandwidth;
+
+		//The assignments of the connections in service, and the connections which can be reused by the next arrivals. The heap of
+		//    the departures has one departure of each connection in service, so no memory is allocated once they have grown:
+		vector<vector<VONEGreedy::EdgeAssignment> > _connection;
+		vector<int> _connection_slot;
+		vector<int> _free_connection;
+		vector<Departure> _departure;
+
+		//Statistics after the warmup arrivals. The requested and blocked slots are the bandwidth of the virtual edges, and the total
+		//    and occupied slots are counted on each core of each link in each direction. The events count the warmup arrivals too:
+		long long _arrival;
+		long long _blocked;
+		long long _requested_slot;
+		long long _blocked_slot;
+		long long _event_number;
+		long long _total_slot;
+		long long _occupied_slot;
+		double _occupied_slot_time;
+		double _observed_time;
+		double _fragmentation_sum;
+		long long _fragmentation_sample;
+		double _simulation_time;
+	};
+}
@@ -0,0 +1,348 @@
+//This file defines class SpectrumOccupancy
+//------------------------------------------------
+//File Name: Spectrum.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#include "Spectrum.h"
+
+#include <algorithm>
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace
+{
+	int get_lowest_bit(const VONESpectrum::SlotWord Word);
+	//Precondition: Word is not 0
+	//Postcondition: Return the position of the lowest 1 bit of Word
+
+	VONESpectrum::SlotWord get_mask(const int First_Bit, const int Bit_Number);
+	//Precondition: 0 <= First_Bit and First_Bit + Bit_Number <= 64
+	//Postcondition: Return the word whose bits from First_Bit to First_Bit + Bit_Number - 1 are 1
+
+	void shift_and(vector<VONESpectrum::SlotWord>& Run, const int Shift);
+	//Precondition: 0 < Shift < 64
+	//Postcondition: The bit i of Run is and-ed with the bit i + Shift, and the bits after the end are taken as 0
+}
+
+namespace VONESpectrum
+{
+	SpectrumOccupancy::SpectrumOccupancy() :_core_number(0)
+	{
+
+	}
+
+	void SpectrumOccupancy::assign(const VONETopo::LinkList& Substrate_Network_Edge, const int C)
+	{
+		_core_number = C;
+		int Edge_Number = static_cast<int>(Substrate_Network_Edge.size());
+		_slot_number.resize(Edge_Number);
+		_word_number.resize(Edge_Number);
+		_word_start.resize(Edge_Number);
+		int Word_Size = 0;
+		for (int sd = 1; sd <= Edge_Number; sd++)
+		{
+			_slot_number[sd - 1] = Substrate_Network_Edge[sd - 1]._edge_bandwidth;
+			_word_number[sd - 1] = (_slot_number[sd - 1] + Slot_Word_Bits - 1) / Slot_Word_Bits;
+			_word_start[sd - 1] = Word_Size;
+			Word_Size += 2 * C * _word_number[sd - 1];
+		}
+
+		//The bits after the last slot are occupied, so no block can pass the end of a core:
+		_word.assign(Word_Size, 0);
+		for (int sd = 1; sd <= Edge_Number; sd++)
+		{
+			int Last_Bits = _slot_number[sd - 1] - (_word_number[sd - 1] - 1) * Slot_Word_Bits;
+			for (int Direction = 0; (Direction <= 1) && (Last_Bits < Slot_Word_Bits); Direction++)
+			{
+				for (int c = 1; c <= C; c++)
+				{
+					get_core(sd, Direction, c)[_word_number[sd - 1] - 1] = get_mask(Last_Bits, Slot_Word_Bits - Last_Bits);
+				}
+			}
+		}
+	}
+
+	int SpectrumOccupancy::get_slot_number(const int Link) const
+	{
+		return _slot_number[Link - 1];
+	}
+
+	int SpectrumOccupancy::get_word_number(const int Link) const
+	{
+		return _word_number[Link - 1];
+	}
+
+	bool SpectrumOccupancy::is_free(const int Link, const int Direction, const int Core, const int Start, const int Width) const
+	{
+		if ((Start < 1) || (Start + Width - 1 > _slot_number[Link - 1]))
+		{
+			return false;
+		}
+
+		const SlotWord* Core_Word = get_core(Link, Direction, Core);
+		for (int Bit = Start - 1; Bit < Start - 1 + Width;)
+		{
+			int Bit_Number = min(Slot_Word_Bits - Bit % Slot_Word_Bits, Start - 1 + Width - Bit);
+			if ((Core_Word[Bit / Slot_Word_Bits] & get_mask(Bit % Slot_Word_Bits, Bit_Number)) != 0)
+			{
+				return false;
+			}
+			Bit += Bit_Number;
+		}
+
+		return true;
+	}
+
+	void SpectrumOccupancy::allocate(const int Link, const int Direction, const int Core, const int Start, const int Width)
+	{
+		set_slots(Link, Direction, Core, Start, Width, true);
+	}
+
+	void SpectrumOccupancy::release(const int Link, const int Direction, const int Core, const int Start, const int Width)
+	{
+		set_slots(Link, Direction, Core, Start, Width, false);
+	}
+
+	void SpectrumOccupancy::get_free_slots(const int Link, const int Direction, const int Core, vector<SlotWord>& Free) const
+	{
+		const SlotWord* Core_Word = get_core(Link, Direction, Core);
+		Free.resize(_word_number[Link - 1]);
+		for (int i = 0; i < _word_number[Link - 1]; i++)
+		{
+			Free[i] = ~Core_Word[i];
+		}
+	}
+
+	void SpectrumOccupancy::and_free_slots(const int Link, const int Direction, const int Core, vector<SlotWord>& Free) const
+	{
+		//The links of a path may have different slots, the slots after the end of the link are not free:
+		const SlotWord* Core_Word = get_core(Link, Direction, Core);
+		int Word_Number = min(static_cast<int>(Free.size()), _word_number[Link - 1]);
+		for (int i = 0; i < Word_Number; i++)
+		{
+			Free[i] &= ~Core_Word[i];
+		}
+		fill(Free.begin() + Word_Number, Free.end(), 0);
+	}
+
+	void SpectrumOccupancy::get_occupied_runs(const int Link, const int Direction, const int Core, vector<pair<int, int> >& Runs) const
+	{
+		Runs.clear();
+		const SlotWord* Core_Word = get_core(Link, Direction, Core);
+		int Run_Start = 0;
+		for (int Bit = 0; Bit < _slot_number[Link - 1]; Bit++)
+		{
+			bool Occupied = (Core_Word[Bit / Slot_Word_Bits] >> (Bit % Slot_Word_Bits) & 1) != 0;
+			if (Occupied && (Run_Start == 0))
+			{
+				Run_Start = Bit + 1;
+			}
+			else if (!Occupied && (Run_Start != 0))
+			{
+				Runs.push_back(make_pair(Run_Start, Bit));
+				Run_Start = 0;
+			}
+		}
+		if (Run_Start != 0)
+		{
+			Runs.push_back(make_pair(Run_Start, _slot_number[Link - 1]));
+		}
+	}
+
+	int SpectrumOccupancy::get_largest_free_block(const int Link, const int Direction, const int Core, int& Free_Number) const
+	{
+		const SlotWord* Core_Word = get_core(Link, Direction, Core);
+		int Largest_Block = 0, Block = 0;
+		Free_Number = 0;
+		for (int Bit = 0; Bit < _slot_number[Link - 1]; Bit++)
+		{
+			if ((Core_Word[Bit / Slot_Word_Bits] >> (Bit % Slot_Word_Bits) & 1) != 0)
+			{
+				Block = 0;
+				continue;
+			}
+			Block++;
+			Free_Number++;
+			Largest_Block = max(Largest_Block, Block);
+		}
+
+		return Largest_Block;
+	}
+
+	int SpectrumOccupancy::get_highest_slot() const
+	{
+		int Highest_Slot = 0;
+		vector<pair<int, int> > Runs;
+		for (int sd = 1; sd <= static_cast<int>(_slot_number.size()); sd++)
+		{
+			for (int Direction = 0; Direction <= 1; Direction++)
+			{
+				for (int c = 1; c <= _core_number; c++)
+				{
+					get_occupied_runs(sd, Direction, c, Runs);
+					if (!Runs.empty())
+					{
+						Highest_Slot = max(Highest_Slot, Runs.back().second);
+					}
+				}
+			}
+		}
+
+		return Highest_Slot;
+	}
+
+	int SpectrumOccupancy::first_fit(const int Link, const int Direction, const int Core, const int Width) const
+	{
+		vector<SlotWord> Free, Run;
+		return first_fit(Link, Direction, Core, Width, Free, Run);
+	}
+
+	int SpectrumOccupancy::first_fit(const int Link, const int Direction, const int Core, const int Width, vector<SlotWord>& Free,
+		vector<SlotWord>& Run) const
+	{
+		get_free_slots(Link, Direction, Core, Free);
+		return first_fit(Free, Width, Run);
+	}
+
+	int SpectrumOccupancy::first_fit(const vector<SlotWord>& Free, const int Width)
+	{
+		vector<SlotWord> Run;
+		return first_fit(Free, Width, Run);
+	}
+
+	int SpectrumOccupancy::first_fit(const vector<SlotWord>& Free, const int Width, vector<SlotWord>& Run)
+	{
+		if (Width <= 0)
+		{
+			return 0;
+		}
+
+		//After the shifts, the bit i of Run is 1 if the bits from i to i + Width - 1 of Free are all 1. The covered width
+		//    doubles at each step, so there are log(Width) passes over the words which are done 64 slots at a time:
+		Run.assign(Free.begin(), Free.end());
+		for (int Covered = 1; Covered < Width;)
+		{
+			int Shift = min(Covered, Width - Covered);
+			for (; Shift >= Slot_Word_Bits; Shift -= Slot_Word_Bits - 1, Covered += Slot_Word_Bits - 1)
+			{
+				shift_and(Run, Slot_Word_Bits - 1);
+			}
+			if (Shift > 0)
+			{
+				shift_and(Run, Shift);
+				Covered += Shift;
+			}
+		}
+
+		for (size_t i = 0; i < Run.size(); i++)
+		{
+			if (Run[i] != 0)
+			{
+				return static_cast<int>(i) * Slot_Word_Bits + get_lowest_bit(Run[i]) + 1;
+			}
+		}
+
+		return 0;
+	}
+
+	int SpectrumOccupancy::best_fit(const vector<SlotWord>& Free, const int Width)
+	{
+		int Best_Start = 0, Best_Length = 0;
+		int Total_Bits = static_cast<int>(Free.size()) * Slot_Word_Bits;
+		for (int Bit = 0; Bit < Total_Bits;)
+		{
+			//Skip the occupied bits to the start of the next run, then to the end of the run:
+			SlotWord Word = Free[Bit / Slot_Word_Bits] & ~get_mask(0, Bit % Slot_Word_Bits);
+			if (Word == 0)
+			{
+				Bit = (Bit / Slot_Word_Bits + 1) * Slot_Word_Bits;
+				continue;
+			}
+			int Run_Start = (Bit / Slot_Word_Bits) * Slot_Word_Bits + get_lowest_bit(Word);
+			int Run_End = Run_Start;
+			while (Run_End < Total_Bits)
+			{
+				SlotWord Occupied = ~Free[Run_End / Slot_Word_Bits] & ~get_mask(0, Run_End % Slot_Word_Bits);
+				if (Occupied != 0)
+				{
+					Run_End = (Run_End / Slot_Word_Bits) * Slot_Word_Bits + get_lowest_bit(Occupied);
+					break;
+				}
+				Run_End = (Run_End / Slot_Word_Bits + 1) * Slot_Word_Bits;
+			}
+
+			int Length = Run_End - Run_Start;
+			if ((Length >= Width) && ((Best_Length == 0) || (Length < Best_Length)))
+			{
+				Best_Start = Run_Start + 1;
+				Best_Length = Length;
+			}
+			Bit = Run_End;
+		}
+
+		return Best_Start;
+	}
+
+	const SlotWord* SpectrumOccupancy::get_core(const int Link, const int Direction, const int Core) const
+	{
+		return &_word[_word_start[Link - 1] + (Direction * _core_number + Core - 1) * _word_number[Link - 1]];
+	}
+
+	SlotWord* SpectrumOccupancy::get_core(const int Link, const int Direction, const int Core)
+	{
+		return &_word[_word_start[Link - 1] + (Direction * _core_number + Core - 1) * _word_number[Link - 1]];
+	}
+
+	void SpectrumOccupancy::set_slots(const int Link, const int Direction, const int Core, const int Start, const int Width,
+		const bool Occupied)
+	{
+		SlotWord* Core_Word = get_core(Link, Direction, Core);
+		for (int Bit = Start - 1; Bit < Start - 1 + Width;)
+		{
+			int Bit_Number = min(Slot_Word_Bits - Bit % Slot_Word_Bits, Start - 1 + Width - Bit);
+			SlotWord Mask = get_mask(Bit % Slot_Word_Bits, Bit_Number);
+			Core_Word[Bit / Slot_Word_Bits] = Occupied ? (Core_Word[Bit / Slot_Word_Bits] | Mask) : (Core_Word[Bit / Slot_Word_Bits] & ~Mask);
+			Bit += Bit_Number;
+		}
+	}
+
+	SpectrumOccupancy::~SpectrumOccupancy()
+	{
+
+	}
+}
+
+namespace
+{
+	int get_lowest_bit(const VONESpectrum::SlotWord Word)
+	{
+#ifdef _MSC_VER
+		unsigned long Position;
+		_BitScanForward64(&Position, Word);
+		return static_cast<int>(Position);
+#else
+		return __builtin_ctzll(Word);
+#endif
+	}
+
+	VONESpectrum::SlotWord get_mask(const int First_Bit, const int Bit_Number)
+	{
+		VONESpectrum::SlotWord Mask = (Bit_Number >= VONESpectrum::Slot_Word_Bits) ? ~VONESpectrum::SlotWord(0) :
+			((VONESpectrum::SlotWord(1) << Bit_Number) - 1);
+		return Mask << First_Bit;
+	}
+
+	void shift_and(vector<VONESpectrum::SlotWord>& Run, const int Shift)
+	{
+		size_t Word_Number = Run.size();
+		for (size_t i = 0; i < Word_Number; i++)
+		{
+			VONESpectrum::SlotWord Next = (i + 1 < Word_Number) ? Run[i + 1] : 0;
+			Run[i] &= (Run[i] >> Shift) | (Next << (VONESpectrum::Slot_Word_Bits - Shift));
+		}
+	}
+}
@@ -0,0 +1,98 @@
+//This file declares class SpectrumOccupancy
+//------------------------------------------------
+//File Name: Spectrum.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include <cstdint>
+#include "Topo.h"
+
+namespace VONESpectrum
+{
+	typedef uint64_t SlotWord;
+	const int Slot_Word_Bits = 64;
+
+	//The occupation of the slots (wavelengths, frequency slots or time slots) of each core of each link in each direction.
+	//    The slots of a core are a bitset of the words in _word, the bit (slot - 1) % 64 of the word (slot - 1) / 64 is 1 if
+	//    the slot is occupied, and the bits after the last slot are always 1
+	class SpectrumOccupancy
+	{
+	public:
+		SpectrumOccupancy();
+
+		void assign(const VONETopo::LinkList& Substrate_Network_Edge, const int C);
+		//Precondition: The links of the substrate network have been assigned
+		//Postcondition: Each link has C cores in each direction with _edge_bandwidth free slots
+
+		int get_slot_number(const int Link) const;
+		//Postcondition: Return the number of the slots of the link (starting from 1)
+
+		int get_word_number(const int Link) const;
+		//Postcondition: Return the number of the words of the bitset of a core of the link
+
+		bool is_free(const int Link, const int Direction, const int Core, const int Start, const int Width) const;
+		//Postcondition: Return true if the slots from Start to Start + Width - 1 of the core are all free
+
+		void allocate(const int Link, const int Direction, const int Core, const int Start, const int Width);
+		//Precondition: The slots from Start to Start + Width - 1 of the core are free
+		//Postcondition: The slots are occupied, O(Width / 64)
+
+		void release(const int Link, const int Direction, const int Core, const int Start, const int Width);
+		//Precondition: The slots from Start to Start + Width - 1 of the core are occupied
+		//Postcondition: The slots are free, O(Width / 64)
+
+		void get_free_slots(const int Link, const int Direction, const int Core, vector<SlotWord>& Free) const;
+		//Postcondition: The bit of a slot in Free is 1 if the slot of the core is free
+
+		void and_free_slots(const int Link, const int Direction, const int Core, vector<SlotWord>& Free) const;
+		//Precondition: Free has at least the words of a core of the link
+		//Postcondition: The slots which are occupied on the core are removed from Free, so a path is reduced link by link
+
+		void get_occupied_runs(const int Link, const int Direction, const int Core, vector<pair<int, int> >& Runs) const;
+		//Postcondition: Runs holds the first and last slots of each maximal run of the occupied slots of the core in order
+
+		int get_largest_free_block(const int Link, const int Direction, const int Core, int& Free_Number) const;
+		//Postcondition: Return the number of the slots of the longest run of the free slots of the core, and Free_Number is
+		//    the number of all its free slots
+
+		int get_highest_slot() const;
+		//Postcondition: Return the highest occupied slot of all cores of all links, or 0 if all slots are free
+
+		int first_fit(const int Link, const int Direction, const int Core, const int Width) const;
+		//Postcondition: Return the lowest start of Width free slots of the core, or 0 if there is no such block
+
+		int first_fit(const int Link, const int Direction, const int Core, const int Width, vector<SlotWord>& Free, 
+			vector<SlotWord>& Run) const;
+		//Postcondition: The same as first_fit above, Free and Run are the buffers of the free slots and the block starts, so
+		//    no memory is allocated once they have grown
+
+		static int first_fit(const vector<SlotWord>& Free, const int Width);
+		//Postcondition: Return the lowest start of Width contiguous 1 bits of Free, or 0 if there is no such block
+
+		static int first_fit(const vector<SlotWord>& Free, const int Width, vector<SlotWord>& Run);
+		//Postcondition: The same as first_fit above, Run is the buffer of the block starts
+
+		static int best_fit(const vector<SlotWord>& Free, const int Width);
+		//Postcondition: Return the start of the shortest run of contiguous 1 bits of Free with at least Width bits (the lowest
+		//    one for the same length), or 0 if there is no such run
+
+		~SpectrumOccupancy();
+
+	private:
+		const SlotWord* get_core(const int Link, const int Direction, const int Core) const;
+		SlotWord* get_core(const int Link, const int Direction, const int Core);
+		//Postcondition: Return the first word of the bitset of the core
+
+		void set_slots(const int Link, const int Direction, const int Core, const int Start, const int Width, const bool Occupied);
+		//Postcondition: The slots from Start to Start + Width - 1 of the core are set to Occupied word by word
+
+		int _core_number;
+		vector<int> _slot_number;
+		vector<int> _word_number;
+		vector<int> _word_start;
+		vector<SlotWord> _word;
+	};
+}
@@ -0,0 +1,244 @@
+//This file defines class VONESweep
+//------------------------------------------------
+//File Name: Sweep.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#include "Sweep.h"
+
+#include <algorithm>
+#include <cmath>
+#include <chrono>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace
+{
+	//The replicas dealt to a thread, which takes them from the front while the other threads steal them from the back
+	struct ReplicaQueue
+	{
+		mutex _lock;
+		deque<int> _replica;
+	};
+
+	bool takeReplica(vector<ReplicaQueue>& Queues, const int Thread, int& Replica, bool& Stolen);
+	//Postcondition: Return false if all queues are empty, otherwise Replica is taken from the front of the queue of Thread, or
+	//    from the back of the queue of the next thread with replicas and Stolen is true
+
+	VONESweep::Estimate getEstimate(const vector<double>& Values, const size_t First, const size_t Number);
+	//Postcondition: Return the mean and the half width of the 95% confidence interval of the Student's t distribution of the
+	//    Number values of Values from First, the half width is 0 for one value
+}
+
+namespace VONESweep
+{
+	SweepOption::SweepOption() :_seed_number(0), _first_seed(1), _thread_number(0)
+	{
+
+	}
+
+	VONESweep::VONESweep() :_type_flag(0), _thread_number(0), _event_number(0), _replica_time(0), _sweep_time(0)
+	{
+
+	}
+
+	void VONESweep::run(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests, int TypeFlag,
+		const VONESimulator::SimulationOption& Simulation, const SweepOption& Option)
+	{
+		chrono::steady_clock::time_point sweep_start = chrono::steady_clock::now();
+		_type_flag = TypeFlag;
+		_point.clear();
+		if (Option._load.empty() || Option._core_number.empty() || (*min_element(Option._load.begin(), Option._load.end()) <= 0))
+		{
+			cerr << "The sweep needs at least one number of cores and positive offered loads.\n";
+			_stolen_number.clear();
+			_event_number = 0;
+			_replica_time = 0;
+			_sweep_time = 0;
+			return;
+		}
+		int Seed_Number = max(Option._seed_number, 1);
+		int Point_Number = static_cast<int>(Option._load.size() * Option._core_number.size());
+		int Replica_Number = Point_Number * Seed_Number;
+		_thread_number = Option._thread_number > 0 ? Option._thread_number : static_cast<int>(thread::hardware_concurrency());
+		_thread_number = max(min(_thread_number, Replica_Number), 1);
+
+		//The replica i is the seed i % Seed_Number of the point i / Seed_Number, and the points are in the order of the cores
+		//    and then the loads:
+		vector<ReplicaQueue> Queues(_thread_number);
+		for (int i = 0; i < Replica_Number; i++)
+		{
+			Queues[i % _thread_number]._replica.push_back(i);
+		}
+
+		//The shortest paths are computed once and read by all replicas:
+		VONEPath::PathCache Paths(Substrate_Network, 1);
+		Paths.compute(Requests, _thread_number, Option._path_table);
+
+		//Each thread only writes the results of its replicas, so the results are not locked:
+		vector<double> Blocking(Replica_Number), Bandwidth_Blocking(Replica_Number), Utilization(Replica_Number),
+			Fragmentation(Replica_Number), Replica_Time(Replica_Number);
+		vector<long long> Event_Number(Replica_Number);
+		_stolen_number.assign(_thread_number, 0);
+		vector<thread> Workers;
+		for (int t = 0; t < _thread_number; t++)
+		{
+			Workers.push_back(thread([&, t]()
+			{
+				int Replica;
+				bool Stolen;
+				while (takeReplica(Queues, t, Replica, Stolen))
+				{
+					int Point = Replica / Seed_Number;
+					VONESimulator::SimulationOption Replica_Option = Simulation;
+					Replica_Option._load = Option._load[Point % Option._load.size()];
+					Replica_Option._seed = Option._first_seed + static_cast<unsigned int>(Replica % Seed_Number);
+					VONESimulator::VONESimulator Simulator;
+					Simulator.simulate(Substrate_Network, Requests, TypeFlag, Option._core_number[Point / Option._load.size()],
+						Replica_Option, &Paths);
+					Blocking[Replica] = Simulator.get_blocking_probability();
+					Bandwidth_Blocking[Replica] = Simulator.get_bandwidth_blocking_probability();
+					Utilization[Replica] = Simulator.get_utilization();
+					Fragmentation[Replica] = Simulator.get_fragmentation();
+					Event_Number[Replica] = Simulator.get_event_number();
+					Replica_Time[Replica] = Simulator.get_simulation_time();
+					_stolen_number[t] += Stolen ? 1 : 0;
+				}
+			}));
+		}
+		for (vector<thread>::iterator WorkerIT = Workers.begin(); WorkerIT != Workers.end(); WorkerIT++)
+		{
+			WorkerIT->join();
+		}
+
+		_point.assign(Point_Number, SweepPoint());
+		_event_number = 0;
+		_replica_time = 0;
+		for (int Point = 0; Point < Point_Number; Point++)
+		{
+			size_t First = static_cast<size_t>(Point) * Seed_Number;
+			SweepPoint& Result = _point[Point];
+			Result._load = Option._load[Point % Option._load.size()];
+			Result._core_number = Option._core_number[Point / Option._load.size()];
+			Result._replica_number = Seed_Number;
+			Result._blocking = getEstimate(Blocking, First, Seed_Number);
+			Result._bandwidth_blocking = getEstimate(Bandwidth_Blocking, First, Seed_Number);
+			Result._utilization = getEstimate(Utilization, First, Seed_Number);
+			Result._fragmentation = getEstimate(Fragmentation, First, Seed_Number);
+			Result._event_number = 0;
+			for (size_t i = First; i < First + Seed_Number; i++)
+			{
+				Result._event_number += Event_Number[i];
+				_replica_time += Replica_Time[i];
+			}
+			_event_number += Result._event_number;
+		}
+		_sweep_time = chrono::duration<double, milli>(chrono::steady_clock::now() - sweep_start).count();
+	}
+
+	void VONESweep::write_csv(ostream& outs) const
+	{
+		outs << "type,load,cores,replicas,blocking,blocking_ci95,bandwidth_blocking,bandwidth_blocking_ci95,utilization,"
+			<< "utilization_ci95,fragmentation,fragmentation_ci95,events" << endl;
+		for (vector<SweepPoint>::const_iterator PointIT = _point.begin(); PointIT != _point.end(); PointIT++)
+		{
+			outs << _type_flag << ',' << PointIT->_load << ',' << PointIT->_core_number << ',' << PointIT->_replica_number << ','
+				<< PointIT->_blocking._mean << ',' << PointIT->_blocking._half_width << ','
+				<< PointIT->_bandwidth_blocking._mean << ',' << PointIT->_bandwidth_blocking._half_width << ','
+				<< PointIT->_utilization._mean << ',' << PointIT->_utilization._half_width << ','
+				<< PointIT->_fragmentation._mean << ',' << PointIT->_fragmentation._half_width << ',' << PointIT->_event_number << endl;
+		}
+	}
+
+	ostream& operator <<(ostream& outs, const VONESweep& Sweep)
+	{
+		int Stolen_Number = 0;
+		for (vector<int>::const_iterator StolenIT = Sweep._stolen_number.begin(); StolenIT != Sweep._stolen_number.end(); StolenIT++)
+		{
+			Stolen_Number += *StolenIT;
+		}
+		outs << "Points = " << Sweep._point.size() << ", Replicas per Point = " << (Sweep._point.empty() ? 0 : Sweep._point[0]._replica_number)
+			<< ", Threads = " << Sweep._thread_number << ", Stolen Replicas = " << Stolen_Number << endl;
+		outs << "Events = " << Sweep._event_number << ", Sweep Time = " << Sweep._sweep_time << "ms, Events per Second = "
+			<< (Sweep._sweep_time > 0 ? Sweep._event_number / Sweep._sweep_time * 1000 : 0) << endl;
+
+		//The replicas keep all threads busy if the sum of their times is the number of threads times the sweep time:
+		outs << "Replica Time = " << Sweep._replica_time << "ms, Parallel Efficiency = "
+			<< (Sweep._sweep_time > 0 ? Sweep._replica_time / Sweep._sweep_time / Sweep._thread_number : 0) << endl;
+		for (vector<SweepPoint>::const_iterator PointIT = Sweep._point.begin(); PointIT != Sweep._point.end(); PointIT++)
+		{
+			outs << "Load = " << PointIT->_load << " Erlang, Cores = " << PointIT->_core_number << ", Blocking Probability = "
+				<< PointIT->_blocking._mean << " +- " << PointIT->_blocking._half_width << ", Spectrum Utilization = "
+				<< PointIT->_utilization._mean << " +- " << PointIT->_utilization._half_width << endl;
+		}
+		return outs;
+	}
+
+	VONESweep::~VONESweep()
+	{
+
+	}
+}
+
+namespace
+{
+	bool takeReplica(vector<ReplicaQueue>& Queues, const int Thread, int& Replica, bool& Stolen)
+	{
+		int Thread_Number = static_cast<int>(Queues.size());
+		for (int i = 0; i < Thread_Number; i++)
+		{
+			ReplicaQueue& Queue = Queues[(Thread + i) % Thread_Number];
+			lock_guard<mutex> Lock(Queue._lock);
+			if (Queue._replica.empty())
+			{
+				continue;
+			}
+
+			Stolen = i != 0;
+			if (Stolen)
+			{
+				Replica = Queue._replica.back();
+				Queue._replica.pop_back();
+			}
+			else
+			{
+				Replica = Queue._replica.front();
+				Queue._replica.pop_front();
+			}
+			return true;
+		}
+
+		return false;
+	}
+
+	VONESweep::Estimate getEstimate(const vector<double>& Values, const size_t First, const size_t Number)
+	{
+		//The 97.5% quantiles of the Student's t distribution of 1 to 30 degrees of freedom, the normal one is used for more:
+		static const double Student_Quantile[30] = { 12.706, 4.303, 3.182, 2.776, 2.571, 2.447, 2.365, 2.306, 2.262, 2.228,
+			2.201, 2.179, 2.160, 2.145, 2.131, 2.120, 2.110, 2.101, 2.093, 2.086, 2.080, 2.074, 2.069, 2.064, 2.060, 2.056, 2.052,
+			2.048, 2.045, 2.042 };
+		VONESweep::Estimate Result;
+		Result._mean = 0;
+		Result._half_width = 0;
+		for (size_t i = First; i < First + Number; i++)
+		{
+			Result._mean += Values[i] / Number;
+		}
+		if (Number < 2)
+		{
+			return Result;
+		}
+
+		double Variance = 0;
+		for (size_t i = First; i < First + Number; i++)
+		{
+			Variance += (Values[i] - Result._mean) * (Values[i] - Result._mean) / (Number - 1);
+		}
+		double Quantile = Number - 1 <= 30 ? Student_Quantile[Number - 2] : 1.960;
+		Result._half_width = Quantile * sqrt(Variance / Number);
+		return Result;
+	}
+}
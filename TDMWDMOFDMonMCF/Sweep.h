@@ -0,0 +1,84 @@
+//This file declares class VONESweep
+//------------------------------------------------
+//File Name: Sweep.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include "Simulator.h"
+
+namespace VONESweep
+{
+	//The points and replicas of a sweep, each point is an offered load and a number of cores
+	struct SweepOption
+	{
+		SweepOption();
+
+		vector<double> _load;		//The offered loads in Erlang
+		vector<int> _core_number;	//The numbers of cores
+		int _seed_number;			//The number of the replicas of each point, the replica s uses the seed _first_seed + s - 1
+		unsigned int _first_seed;
+		int _thread_number;			//The number of threads simulating the replicas, 0 for the number of the hardware threads
+		string _path_table;			//The binary path table of the shortest paths, empty to compute them on every run
+	};
+
+	//The mean and the half width of the 95% confidence interval of a statistic over the replicas of a point
+	struct Estimate
+	{
+		double _mean;
+		double _half_width;
+	};
+
+	//The statistics of the replicas of a point
+	struct SweepPoint
+	{
+		double _load;
+		int _core_number;
+		int _replica_number;
+		Estimate _blocking;
+		Estimate _bandwidth_blocking;
+		Estimate _utilization;
+		Estimate _fragmentation;
+		long long _event_number;
+	};
+
+	//Simulate the replicas of all points of a sweep in parallel: each replica has its own simulator (so its own occupancy) and seed,
+	//    the replicas are dealt to the threads in turn and a thread which has finished its own replicas steals the last replica
+	//    of another thread, so the threads are busy until the last replicas
+	class VONESweep
+	{
+	public:
+		VONESweep();
+
+		void run(const VONETopo::Topo& Substrate_Network, const VONERequest::RequestTable& Requests, int TypeFlag,
+			const VONESimulator::SimulationOption& Simulation, const SweepOption& Option);
+		//Precondition: Topology of substrate netwrok and the requests have been assigned, TypeFlag has been assigned, and
+		//    the loads of Option are positive
+		//Postcondition: No point is simulated and an error is printed if Option has no load or number of cores or a load is
+		//    not positive, otherwise Option._seed_number replicas of each load and number of cores of Option have been simulated with the other
+		//    options of Simulation, and the estimates of each point are recorded
+
+		void write_csv(ostream& outs) const;
+		//Precondition: outs has been connected to an out stream
+		//Postcondition: Print one line of the estimates of each point to outs as CSV with a header line
+
+		friend ostream& operator <<(ostream& outs, const VONESweep& Sweep);
+		//Precondition: outs has been connected to an out stream
+		//Postcondition: Print the statistics of the threads of the sweep to outs
+
+		~VONESweep();
+
+	private:
+		int _type_flag;
+		vector<SweepPoint> _point;
+
+		//The statistics of the threads, the times are the wall times in ms:
+		int _thread_number;
+		vector<int> _stolen_number;
+		long long _event_number;
+		double _replica_time;
+		double _sweep_time;
+	};
+}
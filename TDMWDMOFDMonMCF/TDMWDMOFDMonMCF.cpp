@@ -6,14 +6,28 @@
 //Last Modified: Jun. 30th 2021
 //------------------------------------------------
 
+//Define VONE_NO_CPLEX to build the program without CPLEX, only the greedy engine can be used then:
+#ifndef VONE_NO_CPLEX
 #include "ILP.h"
+#include "Rolling.h"
+#include "Column.h"
+#endif
+#include "Greedy.h"
+#include "Loader.h"
+#include "Simulator.h"
+#include "Sweep.h"
+#include <algorithm>
 #include <fstream>
+#include <string>
+#include <cstring>
+#include <ctime>
 
 namespace
 {
 	static void Usage(const char* ProgramName);
-	int TopologyandTrafficinput(int TypeFlag, string TopoFileName, int NumberofTraffic, string TrafficFileName,
-		VONETopo::Topo& Substrate_Network, vector<VONETopo::Topo>& Virtual_Network_List);
+	int TopologyandTrafficinput(int TypeFlag, string TopoFileName, int NumberofTraffic, string TrafficFileName, int ParserFlag,
+		VONETopo::Topo& Substrate_Network, VONELoader::TrafficLoader& Loader);
+	void getNumberList(const string& Text, vector<double>& Numbers);
 }
 
 //***************Program entry***************//
@@ -24,18 +38,27 @@ namespace
 //-2: One of the name of the arguments is wrong;
 //-3: The topology or traffic input file fails to read, check the return code of function TopologyandTrafficinput;
 //-4: The wrong code usage of the type of the service, check that 0 is tdm, 1 is wdm and 2 is ofdm;
-//-5: The result file fails to open.
+//-5: The result file fails to open;
+//-6: An option is out of its range.
 //
 //ErrorFlag Code which is the return integer value of the TopologyandTrafficinput function can indicate the 
 //mistake details when debug the program:
 //0: There are no errors during the file input;
 //-1: The topology file fails to open;
 //-2: The traffic file fails to open;
-//1: Wrong trafiic file for the service type.
+//1: Wrong trafiic file for the service type;
+//2: A vertex or a number of slots of the traffic file is out of the range of the request table.
 int main(int argc, char **argv)
 {
-	int KindofService, ServiceNumber, CoreNumber, MainError;
-	string TopoFileName, TrafficFileName;
+	int KindofService = -1, ServiceNumber = -1, CoreNumber = -1, MainError;
+	int Engine = 0, ThreadNumber = 0, ParserFlag = 1;
+	string TopoFileName, TrafficFileName, PathTableName;
+	VONESimulator::SimulationOption Simulation;
+	VONESweep::SweepOption Sweep;
+	vector<double> Numbers;
+#ifndef VONE_NO_CPLEX
+	VONEILP::ILPOption Option;
+#endif
 	switch (argc)
 	{
 	    case 1:
@@ -66,7 +89,14 @@ int main(int argc, char **argv)
 			Usage(argv[0]);
 			MainError = -1;
 			break;
-		case 11:
+		default:
+			if (argc % 2 == 0)
+			{
+				Usage(argv[0]);
+				MainError = -1;
+				break;
+			}
+
 			MainError = 0; //There are no errors.
 			for (int i = 2; i <= argc; i=i+2)
 			{
@@ -79,7 +109,78 @@ int main(int argc, char **argv)
 				else if ((strcmp(argv[i - 1], "-s") == 0) || (strcmp(argv[i - 1], "-traffic") == 0))
 					TrafficFileName = argv[i + 1 - 1];
 				else if ((strcmp(argv[i - 1], "-c") == 0) || (strcmp(argv[i - 1], "-cnum") == 0))
+				{
 					CoreNumber = stoi(argv[i + 1 - 1]);
+					getNumberList(argv[i + 1 - 1], Numbers);
+					Sweep._core_number.assign(Numbers.begin(), Numbers.end());
+				}
+				else if ((strcmp(argv[i - 1], "-e") == 0) || (strcmp(argv[i - 1], "-engine") == 0))
+				{
+					Engine = stoi(argv[i + 1 - 1]);
+					if ((Engine < 0) || (Engine > 6))
+					{
+						cerr << "The engine of -engine must be 0 to 6.\n";
+						MainError = -6;
+						break;
+					}
+				}
+				else if ((strcmp(argv[i - 1], "-d") == 0) || (strcmp(argv[i - 1], "-load") == 0))
+				{
+					getNumberList(argv[i + 1 - 1], Sweep._load);
+					if (Sweep._load.empty() || (*min_element(Sweep._load.begin(), Sweep._load.end()) <= 0))
+					{
+						cerr << "The offered loads of -load must be positive.\n";
+						MainError = -6;
+						break;
+					}
+					Simulation._load = Sweep._load.front();
+				}
+				else if ((strcmp(argv[i - 1], "-u") == 0) || (strcmp(argv[i - 1], "-arrival") == 0))
+					Simulation._arrival_number = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-z") == 0) || (strcmp(argv[i - 1], "-seed") == 0))
+					Simulation._seed = static_cast<unsigned int>(stoul(argv[i + 1 - 1]));
+				else if ((strcmp(argv[i - 1], "-f") == 0) || (strcmp(argv[i - 1], "-seeds") == 0))
+					Sweep._seed_number = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-j") == 0) || (strcmp(argv[i - 1], "-thread") == 0))
+					ThreadNumber = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-i") == 0) || (strcmp(argv[i - 1], "-parser") == 0))
+					ParserFlag = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-P") == 0) || (strcmp(argv[i - 1], "-pathtable") == 0))
+					PathTableName = argv[i + 1 - 1];
+#ifndef VONE_NO_CPLEX
+				else if ((strcmp(argv[i - 1], "-o") == 0) || (strcmp(argv[i - 1], "-overlap") == 0))
+					Option._nooverlap_flag = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-b") == 0) || (strcmp(argv[i - 1], "-hop") == 0))
+					Option._hop_slack = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-p") == 0) || (strcmp(argv[i - 1], "-path") == 0))
+					Option._path_number = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-l") == 0) || (strcmp(argv[i - 1], "-lazy") == 0))
+					Option._lazy_flag = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-n") == 0) || (strcmp(argv[i - 1], "-name") == 0))
+					Option._name_flag = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-x") == 0) || (strcmp(argv[i - 1], "-export") == 0))
+					Option._export_flag = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-m") == 0) || (strcmp(argv[i - 1], "-start") == 0))
+					Option._start_flag = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-w") == 0) || (strcmp(argv[i - 1], "-window") == 0))
+					Option._window_size = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-v") == 0) || (strcmp(argv[i - 1], "-reopt") == 0))
+					Option._window_overlap = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-a") == 0) || (strcmp(argv[i - 1], "-batch") == 0))
+					Option._batch_size = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-q") == 0) || (strcmp(argv[i - 1], "-rebuild") == 0))
+					Option._rebuild_flag = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-C") == 0) || (strcmp(argv[i - 1], "-slot") == 0))
+					Option._slot_flag = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-G") == 0) || (strcmp(argv[i - 1], "-offset") == 0))
+					Option._consistency_flag = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-y") == 0) || (strcmp(argv[i - 1], "-symmetry") == 0))
+					Option._symmetry_flag = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-R") == 0) || (strcmp(argv[i - 1], "-rounds") == 0))
+					Option._column_round = stoi(argv[i + 1 - 1]);
+				else if ((strcmp(argv[i - 1], "-g") == 0) || (strcmp(argv[i - 1], "-aggregate") == 0))
+					Option._aggregate_flag = stoi(argv[i + 1 - 1]);
+#endif
 				else
 				{
 					cerr << "Wrong argument name!\n";
@@ -87,54 +188,97 @@ int main(int argc, char **argv)
 					break;
 				}
 			}
-			break;
-		default:
-			Usage(argv[0]);
-			MainError = -1;
+
+			if ((MainError == 0) && ((KindofService < 0) || TopoFileName.empty() || (ServiceNumber < 0)
+				|| TrafficFileName.empty() || (CoreNumber < 0)))
+			{
+				Usage(argv[0]);
+				MainError = -1;
+			}
 	}
 
 	if (MainError != 0)
 	{
 		exit(1);
 	}
+	//The dynamic traffic is simulated by the native first-fit, so it is selected by the offered load with any engine, and the
+	//    sweep is selected by the replicas or more than one load or number of cores:
+	if (Simulation._load > 0)
+	{
+		Engine = (Sweep._seed_number > 0) || (Sweep._load.size() > 1) || (Sweep._core_number.size() > 1) ? 5 : 4;
+		Sweep._first_seed = Simulation._seed;
+		Sweep._thread_number = ThreadNumber;
+		Sweep._path_table = PathTableName;
+	}
+	//The simulation draws the arrivals by the offered load, so an explicit engine of the simulation needs it too:
+	if (((Engine == 4) || (Engine == 5)) && (!(Simulation._load > 0) || (Simulation._arrival_number <= 0)))
+	{
+		cerr << "The simulation needs a positive offered load of -load and a positive number of arrivals of -arrival.\n";
+		Usage(argv[0]);
+		MainError = -6;
+		exit(1);
+	}
+#ifndef VONE_NO_CPLEX
+	if (ThreadNumber > 0)
+	{
+		Option._thread_number = ThreadNumber;
+	}
+	Option._path_table = PathTableName;
+#else
+	if ((Engine != 1) && (Engine != 4) && (Engine != 5))
+	{
+		cerr << "The program is built without CPLEX, the greedy engine is used.\n";
+		Engine = 1;
+	}
+#endif
 
-	//Input the Substrate Network and Virtual Network list:
+	//Input the Substrate Network and the requests, which are kept in the table of the loader:
 	VONETopo::Topo Substrate_Network;
-	vector<VONETopo::Topo> Virtual_Network_List;
+	VONELoader::TrafficLoader Loader;
 	int inputerror;
-	inputerror = TopologyandTrafficinput(KindofService, TopoFileName, ServiceNumber, TrafficFileName, Substrate_Network, Virtual_Network_List);
+	inputerror = TopologyandTrafficinput(KindofService, TopoFileName, ServiceNumber, TrafficFileName, ParserFlag, Substrate_Network,
+		Loader);
+	const VONERequest::RequestTable& Requests = Loader.get_request();
 	if (inputerror != 0)
 	{
 		MainError = -3;
 		exit(1);
 	}
+	cout << Loader << endl;
 	cout << Substrate_Network << endl;
-	for (size_t i = 1; i <= Virtual_Network_List.size(); i++)
-	{
-		cout << "The Virtual Request Topology " << i << " are following:\n";
-		cout << Virtual_Network_List[i - 1] << endl;
-	}
+	cout << "The Virtual Requests are following:\n";
+	cout << Requests << endl;
 	
-	VONEILP::VONECplex SolvexDMonMCFofILP;
 	ofstream output;
 	string ResultFileName;
 	switch (KindofService)
 	{
 	    case 0:
-			ResultFileName = "TDMonMCFILP";
+			ResultFileName = "TDMonMCF";
 			break;
 		case 1:
-			ResultFileName = "WDMonMCFILP";
+			ResultFileName = "WDMonMCF";
 			break;
 		case 2:
-			ResultFileName = "OFDMonMCFILP";
+			ResultFileName = "OFDMonMCF";
 			break;
 		default:
 			cerr << "The type of traffic input wrong!\n";
 			MainError = -4;
 			exit(1);
 	}
-	ResultFileName = ResultFileName + to_string(ServiceNumber) + "Result.txt";
+#ifndef VONE_NO_CPLEX
+	if ((Engine == 0) && (Option._window_size > 0))
+	{
+		Engine = 2;
+	}
+	else if ((Engine == 0) && (Option._batch_size > 0))
+	{
+		Engine = 3;
+	}
+#endif
+	ResultFileName = ResultFileName + (Engine == 1 ? "Greedy" : (Engine == 2 ? "Rolling" : (Engine == 3 ? "Online" :
+		(Engine == 4 ? "Dynamic" : (Engine == 5 ? "Sweep" : (Engine == 6 ? "Column" : "ILP")))))) + to_string(ServiceNumber) + (Engine == 5 ? "Result.csv" : "Result.txt");
 	output.open(ResultFileName.c_str()); //Use result file to record some information
 	if (output.fail())
 	{
@@ -143,14 +287,128 @@ int main(int argc, char **argv)
 		exit(1);
 	}
 
-	//Start to solve the ILP of TDM, WDM or OFDM on MCF:
-	clock_t start = clock();
-	SolvexDMonMCFofILP.solve(Substrate_Network, Virtual_Network_List, KindofService, CoreNumber);
-	clock_t end = clock();
-	output << "\nThe running time of ILP is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
-	cout << "\nThe running time of ILP is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
-	output << SolvexDMonMCFofILP << endl;
-	cout << SolvexDMonMCFofILP << endl;
+	if (Engine == 1)
+	{
+		//Embed the requests of TDM, WDM or OFDM on MCF by the greedy engine:
+		VONEGreedy::VONEGreedy SolvexDMonMCFofGreedy;
+		VONEPath::PathCache Paths(Substrate_Network, 1);
+		clock_t start = clock();
+		Paths.compute(Requests, ThreadNumber, PathTableName);
+		SolvexDMonMCFofGreedy.solve(Substrate_Network, Requests, KindofService, CoreNumber, 0, &Paths);
+		clock_t end = clock();
+		output << Paths;
+		cout << Paths;
+		output << "\nThe running time of the greedy engine is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
+		cout << "\nThe running time of the greedy engine is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
+		output << SolvexDMonMCFofGreedy << endl;
+		cout << SolvexDMonMCFofGreedy << endl;
+	}
+	else if (Engine == 4)
+	{
+		//Simulate the requests of TDM, WDM or OFDM on MCF arriving and departing dynamically:
+		VONESimulator::VONESimulator SimulatexDMonMCF;
+		VONEPath::PathCache Paths(Substrate_Network, 1);
+		Paths.compute(Requests, ThreadNumber, PathTableName);
+		SimulatexDMonMCF.simulate(Substrate_Network, Requests, KindofService, CoreNumber, Simulation, &Paths);
+		output << Paths;
+		cout << Paths;
+		output << SimulatexDMonMCF << endl;
+		cout << SimulatexDMonMCF << endl;
+	}
+	else if (Engine == 5)
+	{
+		//Simulate the replicas of the loads and numbers of cores in parallel, the estimates are recorded as CSV:
+		VONESweep::VONESweep SweepxDMonMCF;
+		SweepxDMonMCF.run(Substrate_Network, Requests, KindofService, Simulation, Sweep);
+		SweepxDMonMCF.write_csv(output);
+		cout << SweepxDMonMCF << endl;
+	}
+#ifndef VONE_NO_CPLEX
+	else if (Engine == 2)
+	{
+		//Solve the ILP of TDM, WDM or OFDM on MCF window by window:
+		VONERolling::VONERolling SolvexDMonMCFofRolling;
+		clock_t start = clock();
+		SolvexDMonMCFofRolling.solve(Substrate_Network, Requests, KindofService, CoreNumber, Option);
+		clock_t end = clock();
+		output << "\nThe running time of the rolling horizon ILP is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
+		cout << "\nThe running time of the rolling horizon ILP is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
+		output << SolvexDMonMCFofRolling << endl;
+		cout << SolvexDMonMCFofRolling << endl;
+	}
+	else if (Engine == 3)
+	{
+		//Solve the ILP of TDM, WDM or OFDM on MCF with the requests added batch by batch to one model:
+		//A batch must add at least one request, and the models of the rebuilds are not extended:
+		Option._batch_size = max(Option._batch_size, 1);
+		VONEILP::ILPOption Rebuild_Option = Option;
+		Rebuild_Option._batch_size = 0;
+		VONEILP::VONECplex SolvexDMonMCFofOnline;
+		clock_t start = clock();
+		size_t First = 0;
+		for (int Batch = 1; First < Requests.size(); Batch++)
+		{
+			size_t Last = min(Requests.size(), First + static_cast<size_t>(Option._batch_size));
+			VONERequest::RequestTable Batch_List = Requests.slice(First, Last);
+			if (First == 0)
+			{
+				SolvexDMonMCFofOnline.solve(Substrate_Network, Batch_List, KindofService, CoreNumber, Option);
+			}
+			else
+			{
+				SolvexDMonMCFofOnline.add_requests(Batch_List);
+			}
+			output << "Batch " << Batch << ": requests " << First + 1 << " to " << Last << ", incremental latency = "
+				<< SolvexDMonMCFofOnline.get_latency() << "ms, objective = " << SolvexDMonMCFofOnline.get_objective();
+			cout << "Batch " << Batch << ": requests " << First + 1 << " to " << Last << ", incremental latency = "
+				<< SolvexDMonMCFofOnline.get_latency() << "ms, objective = " << SolvexDMonMCFofOnline.get_objective();
+
+			//A new model of all requests up to this batch is the baseline of the incremental latency:
+			if ((Option._rebuild_flag == 1) && (First > 0))
+			{
+				VONERequest::RequestTable Prefix_List = Requests.slice(0, Last);
+				VONEILP::VONECplex SolvexDMonMCFofRebuild;
+				SolvexDMonMCFofRebuild.solve(Substrate_Network, Prefix_List, KindofService, CoreNumber, Rebuild_Option);
+				output << ", rebuild latency = " << SolvexDMonMCFofRebuild.get_latency() << "ms, objective = "
+					<< SolvexDMonMCFofRebuild.get_objective();
+				cout << ", rebuild latency = " << SolvexDMonMCFofRebuild.get_latency() << "ms, objective = "
+					<< SolvexDMonMCFofRebuild.get_objective();
+			}
+			output << endl;
+			cout << endl;
+			First = Last;
+		}
+		clock_t end = clock();
+		output << "\nThe running time of the online ILP is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
+		cout << "\nThe running time of the online ILP is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
+		output << SolvexDMonMCFofOnline << endl;
+		cout << SolvexDMonMCFofOnline << endl;
+	}
+	else if (Engine == 6)
+	{
+		//Solve the RSCA of TDM, WDM or OFDM on MCF by column generation:
+		VONEColumn::VONEColumn SolvexDMonMCFofColumn;
+		clock_t start = clock();
+		SolvexDMonMCFofColumn.solve(Substrate_Network, Requests, KindofService, CoreNumber, Option);
+		clock_t end = clock();
+		output << "\nThe running time of the column generation is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
+		cout << "\nThe running time of the column generation is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
+		output << SolvexDMonMCFofColumn << endl;
+		cout << SolvexDMonMCFofColumn << endl;
+	}
+	else
+	{
+		//Start to solve the ILP of TDM, WDM or OFDM on MCF:
+		VONEILP::VONECplex SolvexDMonMCFofILP;
+		clock_t start = clock();
+		SolvexDMonMCFofILP.solve(Substrate_Network, Requests, KindofService, CoreNumber, Option);
+		clock_t end = clock();
+		output << "\nThe running time of ILP is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
+		cout << "\nThe running time of ILP is: " << static_cast<double>(end - start) / CLOCKS_PER_SEC * 1000 << "ms\n\n";
+		output << SolvexDMonMCFofILP << endl;
+		cout << SolvexDMonMCFofILP << endl;
+	}
+#endif
 	output.close();
 
 	return MainError;
@@ -169,11 +427,85 @@ namespace
 		cerr << "\nWhere -rnum/-r <Number of Traffic> is a integer to indicate the number of the traffic.\n";
 		cerr << "\nWhere -traffic/-s <Name of the Traffic File> is a string to describe the file of the input ttaffic.\n";
 		cerr << "\nWhere -cnum/-c <Number of Cores> is a integer to indicate the number of cores the traffic will be used.\n";
-		cerr << "\nThe arguments above must be enough and not too much, or the program will be exit with error code -1." << endl;
+		cerr << "\nThe arguments above must be enough and not too much, or the program will be exit with error code -1.\n";
+		cerr << "\nThe following arguments are optional and can be appended after the arguments above:\n";
+		cerr << "\nWhere -engine/-e <Engine> is an integer to select the engine. 0 is the ILP solved by CPLEX (default) and 1 is"
+			<< " the greedy engine which routes each request on a shortest path and assigns the core and spectrum (or time slots)"
+			<< " by first-fit. 2 is the rolling horizon of -window and 3 is the online batches of -batch, which are also selected"
+			<< " by their options, and 4 is the simulation and 5 is the sweep of -load, which need -load. 6 is the column generation over the configurations of the requests, which starts from the greedy"
+			<< " solution, prices new paths, cores and spectrum (or time slots) by the duals of the master LP, and selects them by"
+			<< " CPLEX at last.\n";
+		cerr << "\nWhere -load/-d <Offered Load> is a number to simulate the dynamic traffic of <Offered Load> Erlang instead of the"
+			<< " engines. The requests arrive as a Poisson process with exponential holding times of mean 1, each arrival is a"
+			<< " request drawn uniformly from the traffic file which is embedded by the first-fit of the greedy engine or blocked."
+			<< " 0 is the default, which solves the requests of the traffic file once.\n";
+		cerr << "\nWhere -arrival/-u <Number of Arrivals> is an integer to indicate the number of the simulated arrivals, the first"
+			<< " 10% of them are not counted in the statistics. 100000 is the default.\n";
+		cerr << "\nWhere -pathtable/-P <Name of the Path Table> is a string to describe a binary file keeping the shortest (or the"
+			<< " candidate) paths of the vertex pairs between runs. The k paths of each pair are kept in the file <Name of the Path"
+			<< " Table>.k<k>, they are read from it in place and the missing ones are computed and saved, so the table is"
+			<< " regenerated when the topology changes. No table is the default.\n";
+		cerr << "\nWhere -seed/-z <Seed> is an integer to indicate the seed of the random numbers of the simulation. 1 is the default.\n";
+		cerr << "\nWhere -seeds/-f <Number of Replicas> is an integer to sweep the simulation. Each of the loads of -load and each of"
+			<< " the numbers of cores of -cnum, which can be lists like 100,200,300, is simulated by <Number of Replicas> replicas with"
+			<< " the seeds from <Seed> in parallel, and the means and 95% confidence intervals are written to a .csv file. A list of"
+			<< " loads or cores sweeps them with one replica.\n";
+		cerr << "\nWhere -thread/-j <Number of Threads> is an integer to indicate the number of threads. They compute the shortest"
+			<< " paths of the vertex pairs of the requests and simulate the replicas of the sweep (all hardware threads by default),"
+			<< " and generate the no overlap and time slot consistency constraints of the ILP (1 by default), whose model is the"
+			<< " same for any number of threads.\n";
+		cerr << "\nWhere -parser/-i <Traffic Parser> is an integer to select the input of the traffic file. 1 maps the file into memory"
+			<< " and parses it in place (default), and 0 reads it by the stream one number at a time. The parsing time and"
+			<< " throughput of both are printed to compare them.\n";
+		cerr << "\nThe options below are only for the ILP.\n";
+		cerr << "\nWhere -overlap/-o <No Overlap Formulation> is an integer to select the spectrum no overlap constraints."
+			<< " 0 is the logical constraints (default) and 1 is the linearized big-M constraints.\n";
+		cerr << "\nWhere -hop/-b <Hop Slack> is an integer to restrict each request to the links on its paths at most <Hop Slack> hops"
+			<< " longer than its shortest path, and the no overlap constraints are only built on the links shared by both requests."
+			<< " A negative value (default) keeps all links.\n";
+		cerr << "\nWhere -path/-p <Number of Candidate Paths> is an integer to select the formulation. 0 is the arc-flow formulation"
+			<< " (default) and k > 0 is the path formulation where each request selects one of its k shortest paths.\n";
+		cerr << "\nWhere -lazy/-l <Lazy No Overlap> is an integer to build the spectrum no overlap constraints of the arc-flow formulation."
+			<< " 0 builds all of them (default) and 1 only adds the ones of the request pairs overlapping in the last solution"
+			<< " and solves again until no overlap is left.\n";
+		cerr << "\nWhere -name/-n <Variable Names> is an integer to name the variables of the ILP. 1 names them when"
+			<< " they are created (default) and 0 only records their indexes and names them for the export and the printed solution.\n";
+		cerr << "\nWhere -export/-x <Export Model> is an integer to export the model to the .lp file. 1 exports it (default)"
+			<< " and 0 skips the export.\n";
+		cerr << "\nWhere -start/-m <MIP Start> is an integer to give CPLEX a MIP start of the arc-flow formulation. 1 solves the"
+			<< " greedy engine first and uses its solution when no request is blocked and -offset is not 1 for WDM or OFDM, and 0"
+			<< " solves from a cold model (default).\n";
+		cerr << "\nWhere -window/-w <Window Size> is an integer to solve the requests in windows of <Window Size> requests by the"
+			<< " arc-flow formulation, where the resources of the earlier windows are fixed. 0 solves all requests in one ILP (default).\n";
+		cerr << "\nWhere -reopt/-v <Re-optimized Requests> is an integer to solve the last <Re-optimized Requests> requests of a window"
+			<< " again in the next window. 0 is the default, and it is at most <Window Size> - 1.\n";
+		cerr << "\nWhere -batch/-a <Batch Size> is an integer to add the requests in batches of <Batch Size> requests to one model of"
+			<< " the arc-flow formulation, which is solved again from the last solution after each batch. 0 solves all requests at"
+			<< " once (default).\n";
+		cerr << "\nWhere -rebuild/-q <Rebuild> is an integer to compare the latency of each batch. 1 also solves a new model of all"
+			<< " requests up to the batch, and 0 does not (default).\n";
+		cerr << "\nWhere -slot/-C <Time Slot Formulation> is an integer to select the time slots of TDM in the arc-flow formulation."
+			<< " 0 gives each link of a request its own time slots which are kept the same by the consistency constraints (default),"
+			<< " and 1 is the compact formulation where the time slots belong to the request, which has fewer variables and rows and"
+			<< " needs all no overlap constraints built.\n";
+		cerr << "\nWhere -offset/-G <Consistency Formulation> is an integer to keep the spectrum (or time slots) of a virtual edge the"
+			<< " same on its links in the arc-flow formulation. 0 ties each two links of a TDM request by logical constraints, which"
+			<< " grow quadratically in the links (default, none for WDM or OFDM), and 1 ties each link to a global offset of the"
+			<< " virtual edge by linear constraints, which grow linearly in the links.\n";
+		cerr << "\nWhere -symmetry/-y <Core Symmetry Breaking> is an integer to break the symmetry of the cores of the arc-flow"
+			<< " formulation. 1 lets a request use a core of a link only if the previous core is used there by it or an earlier"
+			<< " request, which keeps the optimum and prunes the equivalent solutions of the C! core permutations, and 0 does not"
+			<< " (default). The branch nodes are printed with the solution to compare them.\n";
+		cerr << "\nWhere -aggregate/-g <Demand Aggregation> is an integer to group the identical requests, which have the same source,"
+			<< " destination, type and slots, into classes. 1 orders the requests of each class in the ILP, whose report prints the"
+			<< " classes, which keeps the optimum and prunes the permutations of the identical requests, and 0 does not (default).\n";
+		cerr << "\nWhere -rounds/-R <Column Generation Rounds> is an integer to indicate the most rounds of pricing of the column"
+			<< " generation (-engine/-e 6) before its integer phase. 100 is the default. The LP objective, the Lagrangian bound (a"
+			<< " heuristic estimate for TDM), the added columns and the times of each round are printed.\n" << endl;
 	}
 
-	int TopologyandTrafficinput(int TypeFlag, string TopoFileName, int NumberofTraffic, string TrafficFileName,  
-		VONETopo::Topo& Substrate_Network, vector<VONETopo::Topo>& Virtual_Network_List)
+	int TopologyandTrafficinput(int TypeFlag, string TopoFileName, int NumberofTraffic, string TrafficFileName, int ParserFlag,
+		VONETopo::Topo& Substrate_Network, VONELoader::TrafficLoader& Loader)
 	{
 		//Topo input:
 		int ErrorFlag = 0; //There are no errors.
@@ -188,42 +520,32 @@ namespace
 		topoinput >> Substrate_Network;
 		topoinput.close();
 
-		//Traffic input:
-		int Source, Destination, Type, Slot;
-		ifstream trafficinput;
-		trafficinput.open(TrafficFileName.c_str());
-		if (trafficinput.fail())
+		//Traffic input, the mapped file is parsed into the table of the loader unless the stream input is selected:
+		int TrafficError = ParserFlag == 0 ? Loader.load_stream(TrafficFileName, TypeFlag, NumberofTraffic) :
+			Loader.load(TrafficFileName, TypeFlag, NumberofTraffic);
+		if (TrafficError != 0)
 		{
-			cerr << "Traffic input file opened failed.\n";
-			ErrorFlag = -2;
+			ErrorFlag = TrafficError;
 		}
 
-		int Num = 0;
-		while (trafficinput >> Source >> Destination >> Type >> Slot)
+		return ErrorFlag;
+	}
+
+	void getNumberList(const string& Text, vector<double>& Numbers)
+	{
+		Numbers.clear();
+		for (size_t First = 0; First < Text.size();)
 		{
-			if (Num == NumberofTraffic)
-				break;
-			else
+			size_t Last = Text.find(',', First);
+			if (Last == string::npos)
 			{
-				if (TypeFlag != Type)
-				{
-					cerr << "Traffic file does not fit its type!\n";
-					ErrorFlag = 1;
-					break;
-				}
-				else
-				{
-					VONETopo::Topo VN_tmp;
-					VN_tmp.AddVertex(1, Source);
-					VN_tmp.AddVertex(2, Destination);
-					VN_tmp.AddEdge(1, 2, Slot);
-					Virtual_Network_List.push_back(VN_tmp);
-				}
-				Num = Num + 1;
+				Last = Text.size();
 			}
+			if (Last > First)
+			{
+				Numbers.push_back(stod(Text.substr(First, Last - First)));
+			}
+			First = Last + 1;
 		}
-		trafficinput.close();
-
-		return ErrorFlag;
 	}
 }
@@ -14,6 +14,9 @@
 namespace
 {
 	bool less_edge_id(const VONETopo::Edge& FirstEdge, const VONETopo::Edge& SecondEdge);
+
+	long long getEdgeKey(const int Source, const int Destination);
+	//Postcondition: Return the same key of the edge between Source and Destination in both directions
 }
 
 namespace VONETopo
@@ -51,41 +54,39 @@ namespace VONETopo
 	void Topo::AddVertex(const int VertexID, const int Computing_Capacity)
 	{
 		Vertex vertex_tmp = { VertexID, Computing_Capacity };
+		_vertex_position.emplace(VertexID, static_cast<int>(_vertex.size()));
 		_vertex.push_back(vertex_tmp);
 		_vertex_num = static_cast<int>(_vertex.size());
 	}
 
 	void Topo::AddEdge(const int Source, const int Destination, const int Bandwidth)
 	{
-		NodeListIT Niter_Source, Niter_Destination;
 		if (Source != Destination)
 		{
-			NodeListIT Niter = find_if(_vertex.begin(), _vertex.end(), Vertex_finder(Source));
-			if (Niter != _vertex.end())
+			int Source_Position = find_vertex(Source);
+			if (Source_Position >= 0)
 			{
-				Niter_Source = Niter;
-				Niter = find_if(_vertex.begin(), _vertex.end(), Vertex_finder(Destination));
-				if (Niter != _vertex.end())
+				int Destination_Position = find_vertex(Destination);
+				if (Destination_Position >= 0)
 				{
-					Niter_Destination = Niter;
-					LinkListIT Giter = find_if(_edge.begin(), _edge.end(), Edge_finder(Source, Destination));
-					if (Giter == _edge.end())
+					if (find_edge(Source, Destination) < 0)
 					{
 						Edge edge;
 						edge._edge_id = _edge_num + 1;
 						edge._edge_bandwidth = Bandwidth;
 
-						if (Niter_Source->_vertex_id < Niter_Destination->_vertex_id)
+						if (Source < Destination)
 						{
-							edge._edge_source = *Niter_Source;
-							edge._edge_destination = *Niter_Destination;
+							edge._edge_source = _vertex[Source_Position];
+							edge._edge_destination = _vertex[Destination_Position];
 						}
 						else
 						{
-							edge._edge_source = *Niter_Destination;
-							edge._edge_destination = *Niter_Source;
+							edge._edge_source = _vertex[Destination_Position];
+							edge._edge_destination = _vertex[Source_Position];
 						}
 
+						_edge_position.emplace(getEdgeKey(Source, Destination), static_cast<int>(_edge.size()));
 						_edge.push_back(edge);
 					}
 					else
@@ -129,13 +130,11 @@ namespace VONETopo
 				swap(Start_Capacity, End_Capacity);
 			}
 
-			NodeListIT Niter = find_if(Topology._vertex.begin(), Topology._vertex.end(), Vertex_finder(Start));
-			if (Niter == Topology._vertex.end())
+			if (Topology.find_vertex(Start) < 0)
 			{
 				Topology.AddVertex(Start, Start_Capacity);
 			}
-			Niter = find_if(Topology._vertex.begin(), Topology._vertex.end(), Vertex_finder(End));
-			if (Niter == Topology._vertex.end())
+			if (Topology.find_vertex(End) < 0)
 			{
 				Topology.AddVertex(End, End_Capacity);
 			}
@@ -143,6 +142,7 @@ namespace VONETopo
 			(Topology._edge.end() - 1)->_edge_id = Link_ID;
 		}
 		sort(Topology._edge.begin(), Topology._edge.end(), less_edge_id);
+		Topology.finalize();
 
 		return ins;
 	}
@@ -174,6 +174,60 @@ namespace VONETopo
 		EdgesSet = _edge;
 	}
 
+	void Topo::finalize()
+	{
+		//The edges may be sorted after they are added, so their positions are found again:
+		_edge_position.clear();
+		for (int e = 0; e < _edge_num; e++)
+		{
+			_edge_position.emplace(getEdgeKey(_edge[e]._edge_source._vertex_id, _edge[e]._edge_destination._vertex_id), e);
+		}
+
+		//Count the edges of each vertex, then place them by the prefix sums of the counts:
+		_adjacency._out_offset.assign(_vertex_num + 1, 0);
+		_adjacency._in_offset.assign(_vertex_num + 1, 0);
+		vector<int> Source_Position(_edge_num), Destination_Position(_edge_num);
+		for (int e = 0; e < _edge_num; e++)
+		{
+			Source_Position[e] = find_vertex(_edge[e]._edge_source._vertex_id);
+			Destination_Position[e] = find_vertex(_edge[e]._edge_destination._vertex_id);
+			_adjacency._out_offset[Source_Position[e] + 1]++;
+			_adjacency._in_offset[Destination_Position[e] + 1]++;
+		}
+		for (int v = 0; v < _vertex_num; v++)
+		{
+			_adjacency._out_offset[v + 1] += _adjacency._out_offset[v];
+			_adjacency._in_offset[v + 1] += _adjacency._in_offset[v];
+		}
+
+		_adjacency._out_edge.resize(_edge_num);
+		_adjacency._in_edge.resize(_edge_num);
+		vector<int> Out_Next(_adjacency._out_offset.begin(), _adjacency._out_offset.end() - 1);
+		vector<int> In_Next(_adjacency._in_offset.begin(), _adjacency._in_offset.end() - 1);
+		for (int e = 0; e < _edge_num; e++)
+		{
+			_adjacency._out_edge[Out_Next[Source_Position[e]]++] = e + 1;
+			_adjacency._in_edge[In_Next[Destination_Position[e]]++] = e + 1;
+		}
+	}
+
+	int Topo::find_vertex(const int VertexID) const
+	{
+		unordered_map<int, int>::const_iterator VertexIT = _vertex_position.find(VertexID);
+		return VertexIT == _vertex_position.end() ? -1 : VertexIT->second;
+	}
+
+	int Topo::find_edge(const int Source, const int Destination) const
+	{
+		unordered_map<long long, int>::const_iterator EdgeIT = _edge_position.find(getEdgeKey(Source, Destination));
+		return EdgeIT == _edge_position.end() ? -1 : EdgeIT->second;
+	}
+
+	const Adjacency& Topo::get_adjacency() const
+	{
+		return _adjacency;
+	}
+
 	Topo::~Topo()
 	{
 
@@ -186,4 +240,9 @@ namespace
 	{
 		return FirstEdge._edge_id < SecondEdge._edge_id;
 	}
+
+	long long getEdgeKey(const int Source, const int Destination)
+	{
+		return (static_cast<long long>(min(Source, Destination)) << 32) | static_cast<unsigned int>(max(Source, Destination));
+	}
 }
\ No newline at end of file
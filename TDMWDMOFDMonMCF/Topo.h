@@ -9,6 +9,7 @@
 #pragma once
 #include <iostream>
 #include <vector>
+#include <unordered_map>
 
 using namespace std;
 
@@ -66,6 +67,18 @@ namespace VONETopo
 		int _edge_destination;
 	};
 
+	//The incidence lists of the vertexes of a topology in compressed sparse row form. The edges whose source is the vertex at
+	//    position v of the NodeList are _out_edge[_out_offset[v]] to _out_edge[_out_offset[v + 1] - 1], and the edges whose
+	//    destination is it are the same in _in_offset and _in_edge. An edge is its position (starting from 1) in the LinkList,
+	//    and the edges of a vertex are in the order of the LinkList
+	struct Adjacency
+	{
+		vector<int> _out_offset;
+		vector<int> _out_edge;
+		vector<int> _in_offset;
+		vector<int> _in_edge;
+	};
+
 	//Create the Topology of substrate network or virtual network
 	class Topo
 	{
@@ -78,9 +91,12 @@ namespace VONETopo
 		void AddEdge(const int Source, const int Destination, const int Bandwidth = 320);	//50 for test, 320 for real network
 		//Postcondition: Put the Edge with the properties of the addition order, Source, Destination and Bandwidth in _edge
 
+		void finalize();
+		//Postcondition: The incidence lists of the vertexes have been built for the vertexes and edges added so far
+
 		friend istream& operator >>(istream& ins, Topo& Topology);
 		//Precondition: ins should be connected to the screen or a file
-		//Postcondition: the topology has been put in _edge
+		//Postcondition: the topology has been put in _edge and finalized
 
 		friend ostream& operator <<(ostream& outs, const Topo& Topology);
 		//Precondition: outs should be connected to the screen or a file
@@ -94,6 +110,17 @@ namespace VONETopo
 		//Precondition: the topology has been assigned
 		//Postcondition: return the topology _edge
 
+		int find_vertex(const int VertexID) const;
+		//Postcondition: Return the position (starting from 0) of the vertex VertexID in _vertex, or -1 if it is not in the topology
+
+		int find_edge(const int Source, const int Destination) const;
+		//Postcondition: Return the position (starting from 0) of the edge between Source and Destination in either direction
+		//    in _edge, or -1 if it is not in the topology
+
+		const Adjacency& get_adjacency() const;
+		//Precondition: The topology has been finalized after its last vertex and edge are added
+		//Postcondition: Return the incidence lists of the vertexes
+
 		~Topo();
 
 	private:
@@ -101,5 +128,10 @@ namespace VONETopo
 		int _vertex_num;
 		int _edge_num;
 		LinkList _edge;
+
+		//The positions of the vertexes by their IDs and of the edges by their two vertexes (the lower ID in the high 32 bits):
+		unordered_map<int, int> _vertex_position;
+		unordered_map<long long, int> _edge_position;
+		Adjacency _adjacency;
 	};
 }
\ No newline at end of file
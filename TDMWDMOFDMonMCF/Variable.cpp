@@ -0,0 +1,209 @@
+//This file defines class VariableTable and class VarIndex
+//------------------------------------------------
+//File Name: Variable.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#include "Variable.h"
+
+namespace VONEILP
+{
+	VariableKey::VariableKey(const char Type, const int r, const int a, const int b, const int sd, const int Direction) :
+		_type(Type), _direction(static_cast<char>(Direction)), _sd(sd), _r(r), _a(a), _b(b)
+	{
+
+	}
+
+	VariableTable::VariableTable() :_type_flag(0), _name_flag(1), _name_number(0), _name_bytes(0)
+	{
+
+	}
+
+	void VariableTable::assign(const VONETopo::LinkList& Substrate_Network_Edge, const vector<int>& Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth, const int TypeFlag, const int Name_Flag)
+	{
+		_edge = Substrate_Network_Edge;
+		_virtual_edge_number = Virtual_Networks_Edge_Number;
+		_virtual_bandwidth = Virtual_Networks_Bandwidth;
+		_type_flag = TypeFlag;
+		_name_flag = Name_Flag;
+		_key.clear();
+		_name_number = 0;
+		_name_bytes = 0;
+	}
+
+	void VariableTable::extend(const vector<int>& Virtual_Networks_Edge_Number, const vector<int>& Virtual_Networks_Bandwidth)
+	{
+		_virtual_edge_number = Virtual_Networks_Edge_Number;
+		_virtual_bandwidth = Virtual_Networks_Bandwidth;
+	}
+
+	const char* VariableTable::add(const VariableKey& Key)
+	{
+		if (_name_flag == 0)
+		{
+			_key.push_back(Key);
+			return 0;
+		}
+
+		get_name(Key, _name);
+		_name_number++;
+		_name_bytes += static_cast<long long>(_name.size()) + 1;
+		return _name.c_str();
+	}
+
+	string VariableTable::get_name(const size_t Index) const
+	{
+		string Name;
+		get_name(_key[Index], Name);
+		return Name;
+	}
+
+	size_t VariableTable::size() const
+	{
+		return _key.size();
+	}
+
+	long long VariableTable::get_name_number() const
+	{
+		return _name_number;
+	}
+
+	long long VariableTable::get_name_bytes() const
+	{
+		return _name_bytes;
+	}
+
+	int VariableTable::get_name_flag() const
+	{
+		return _name_flag;
+	}
+
+	void VariableTable::get_name(const VariableKey& Key, string& Name) const
+	{
+		if (Key._type == 'y')
+		{
+			Name = "y_" + to_string(Key._r) + "_" + to_string(Key._a) + "_" + to_string(Key._b);
+			return;
+		}
+
+		//The variables of the compact TDM formulation and the global offsets belong to the requests, so they have no link:
+		if (Key._type == 'T')
+		{
+			Name = "t_" + to_string(Key._r) + "_" + to_string(Key._a);
+			return;
+		}
+		if (Key._type == 'g')
+		{
+			Name = "g_" + to_string(Key._r) + "_" + (_type_flag == 0 ? to_string(Key._a) + "_" : string()) + to_string(Key._b);
+			return;
+		}
+		if (Key._type == 'P')
+		{
+			int slot2 = Key._b % _virtual_bandwidth[Key._a - 1] + 1;
+			int slot1 = Key._b / _virtual_bandwidth[Key._a - 1] + 1;
+			Name = "O_" + to_string(Key._r) + "_" + to_string(Key._a) + "_" + to_string(slot1) + "_" + to_string(slot2);
+			return;
+		}
+
+		//The variables of the path formulation belong to the requests or their candidate paths:
+		switch (Key._type)
+		{
+			case 'p':
+				Name = "P_" + to_string(Key._r) + "_" + to_string(Key._a);
+				return;
+			case 'C':
+				Name = "X_" + to_string(Key._r) + "_" + to_string(Key._a) + "_" + to_string(Key._b);
+				return;
+			case 'F':
+				Name = "f_" + to_string(Key._r);
+				return;
+			case 'S':
+				Name = "Ms_" + to_string(Key._r);
+				return;
+			case 'Q':
+				Name = "O_" + to_string(Key._r) + "_" + to_string(Key._a);
+				return;
+		}
+
+		//The vertexes of the link in the direction of the variable:
+		const VONETopo::Edge& Link = _edge[Key._sd - 1];
+		string Link_Name = (Key._direction == 0) ?
+			to_string(Link._edge_source._vertex_id) + "_" + to_string(Link._edge_destination._vertex_id) :
+			to_string(Link._edge_destination._vertex_id) + "_" + to_string(Link._edge_source._vertex_id);
+
+		switch (Key._type)
+		{
+			case 'x':
+			case 'X':
+			case 'f':
+				Name = string(1, Key._type) + "_" + to_string(Key._r) + "_" + to_string(Key._a) + "_" + Link_Name;
+				break;
+			case 'M':
+				Name = "Ms_" + to_string(Key._r) + "_" + to_string(Key._a) + "_" + Link_Name;
+				break;
+			case 't':
+				Name = "t_" + to_string(Key._r) + "_" + to_string(Key._a) + "_" + to_string(Key._b) + "_" + Link_Name;
+				break;
+			case 'O':
+			{
+				//The order variables of a request pair on a link are in the order of (slot1, slot2, e1, e2) for TDM or (e1, e2):
+				int Edge_Number_r1 = _virtual_edge_number[Key._r - 1];
+				int Edge_Number_r2 = _virtual_edge_number[Key._a - 1];
+				int e2 = Key._b % Edge_Number_r2 + 1;
+				int e1 = Key._b / Edge_Number_r2 % Edge_Number_r1 + 1;
+				Name = "O_" + to_string(Key._r) + "_" + to_string(Key._a) + "_";
+				if (_type_flag == 0)
+				{
+					int Slot_Pair = Key._b / (Edge_Number_r1 * Edge_Number_r2);
+					int slot2 = Slot_Pair % _virtual_bandwidth[Key._a - 1] + 1;
+					int slot1 = Slot_Pair / _virtual_bandwidth[Key._a - 1] + 1;
+					Name += to_string(slot1) + "_" + to_string(slot2) + "_";
+				}
+				Name += to_string(e1) + "_" + to_string(e2) + "_" + Link_Name;
+				break;
+			}
+			default:
+				Name = "v_" + to_string(Key._r);
+		}
+	}
+
+	VariableTable::~VariableTable()
+	{
+
+	}
+
+	VarIndex::VarIndex() :_substrate_vertex_number(0), _substrate_edge_number(0), _core_number(0)
+	{
+
+	}
+
+	void VarIndex::assign(const int Request_Number, const int Substrate_Network_Vertex_Number, const int Substrate_Network_Edge_Number,
+		const vector<int>& Virtual_Networks_Vertex_Number, const vector<int>& Accumulate_Virtual_Networks_Vertex_Number,
+		const vector<int>& Virtual_Networks_Edge_Number, const vector<int>& Accumulate_Virtual_Networks_Edge_Number,
+		const vector<int>& Virtual_Networks_Bandwidth, const vector<int>& Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth,
+		const int C)
+	{
+		_substrate_vertex_number = Substrate_Network_Vertex_Number;
+		_substrate_edge_number = Substrate_Network_Edge_Number;
+		_core_number = C;
+		_request.resize(Request_Number);
+		for (int r = 1; r <= Request_Number; r++)
+		{
+			RequestIndex& Request = _request[r - 1];
+			Request._node_start = Accumulate_Virtual_Networks_Vertex_Number[r - 1] * Substrate_Network_Vertex_Number;
+			Request._edge_start = Accumulate_Virtual_Networks_Edge_Number[r - 1] * 2 * Substrate_Network_Edge_Number;
+			Request._slot_start = Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth[r - 1] * 2 * Substrate_Network_Edge_Number;
+			Request._vertex_number = Virtual_Networks_Vertex_Number[r - 1];
+			Request._edge_number = Virtual_Networks_Edge_Number[r - 1];
+			Request._bandwidth = Virtual_Networks_Bandwidth[r - 1];
+		}
+	}
+
+	VarIndex::~VarIndex()
+	{
+
+	}
+}
\ No newline at end of file
@@ -0,0 +1,178 @@
+//This file declares class VariableTable and class VarIndex
+//------------------------------------------------
+//File Name: Variable.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include <string>
+#include <cassert>
+#include "Topo.h"
+
+namespace VONEILP
+{
+	//The indexes of a variable of the arc-flow formulation, _type is the first letter of its name:
+	//'y': y_r_v_s with _a = v and _b = s;
+	//'x', 'X', 'f', 'M': x_r_e, X_r_c, f_r_e or Ms_r_e on the link _sd in the direction _direction with _a = e or c;
+	//'t': t_r_slot_e on the link _sd in the direction _direction with _a = slot and _b = e;
+	//'O': the order variable of the requests _r and _a on the link _sd, _b is its position among the order variables of the pair;
+	//'T': t_r_slot of the compact TDM formulation with _a = slot;
+	//'g': the global offset g_r_slot_e (TDM) or g_r_e (WDM or OFDM) of the virtual edge _b with _a = slot;
+	//'P': the order variable O_r1_r2_slot1_slot2 of the compact TDM formulation with _r = r1, _a = r2 and 
+	//    _b = (slot1 - 1) * the bandwidth of r2 + slot2 - 1, which is shared by all links. The path formulation uses 'T' and 'P' for
+	//    its time slots and order variables of TDM as well;
+	//'p': the path variable P_r_k of the path formulation with _a = k;
+	//'C': the core variable X_r_k_c of the path formulation with _a = k and _b = c;
+	//'F', 'S': the start index f_r and the spectrum end index Ms_r of the path formulation;
+	//'Q': the order variable O_r1_r2 of the path formulation for WDM or OFDM with _r = r1 and _a = r2.
+	struct VariableKey
+	{
+		VariableKey(const char Type, const int r, const int a, const int b, const int sd, const int Direction);
+
+		char _type;
+		char _direction;
+		int _sd;
+		int _r;
+		int _a;
+		int _b;
+	};
+
+	//Give names to the variables when they are created, or only record their keys and give the names when they are needed
+	class VariableTable
+	{
+	public:
+		VariableTable();
+
+		void assign(const VONETopo::LinkList& Substrate_Network_Edge, const vector<int>& Virtual_Networks_Edge_Number,
+			const vector<int>& Virtual_Networks_Bandwidth, const int TypeFlag, const int Name_Flag);
+		//Precondition: The parameters of the ILP have been assigned
+		//Postcondition: The table is empty, and names are built when the variables are created if Name_Flag is 1
+
+		void extend(const vector<int>& Virtual_Networks_Edge_Number, const vector<int>& Virtual_Networks_Bandwidth);
+		//Precondition: The requests of the table are the first requests of the parameters
+		//Postcondition: The parameters of the requests are replaced to name the variables of the new requests, and the recorded keys
+		//    are kept
+
+		const char* add(const VariableKey& Key);
+		//Postcondition: Return the name of Key which is valid until the next call if the names are built when the variables are 
+		//    created, otherwise Key is recorded and 0 is returned so the variable has no name
+
+		string get_name(const size_t Index) const;
+		//Precondition: The names are not built when the variables are created, and Index is less than size()
+		//Postcondition: Return the name of the variable added by the (Index + 1)th call of add
+
+		size_t size() const;
+		//Postcondition: Return the number of the recorded keys
+
+		long long get_name_number() const;
+		//Postcondition: Return the number of the names built by add
+
+		long long get_name_bytes() const;
+		//Postcondition: Return the bytes of the names built by add including their terminating characters
+
+		int get_name_flag() const;
+
+		~VariableTable();
+
+	private:
+		void get_name(const VariableKey& Key, string& Name) const;
+		//Postcondition: Name is the name of the variable of Key
+
+		VONETopo::LinkList _edge;
+		vector<int> _virtual_edge_number;
+		vector<int> _virtual_bandwidth;
+		int _type_flag;
+		int _name_flag;
+
+		vector<VariableKey> _key;
+		string _name;
+		long long _name_number;
+		long long _name_bytes;
+	};
+
+	//Map the indexes of a variable of the arc-flow formulation to its position in its variable array, 
+	//    the positions are checked by assert when NDEBUG is not defined
+	class VarIndex
+	{
+	public:
+		VarIndex();
+
+		void assign(const int Request_Number, const int Substrate_Network_Vertex_Number, const int Substrate_Network_Edge_Number,
+			const vector<int>& Virtual_Networks_Vertex_Number, const vector<int>& Accumulate_Virtual_Networks_Vertex_Number,
+			const vector<int>& Virtual_Networks_Edge_Number, const vector<int>& Accumulate_Virtual_Networks_Edge_Number,
+			const vector<int>& Virtual_Networks_Bandwidth, const vector<int>& Accumulate_Virtual_Networks_Edge_Number_and_Bandwidth, 
+			const int C);
+		//Precondition: The parameters of the ILP have been assigned
+		//Postcondition: The start positions of the variables of each request have been computed
+
+		int node(const int r, const int v, const int s) const;
+		//Postcondition: Return the position of y_r_v_s which maps the virtual vertex v of the request r to the substrate vertex s
+
+		int edge(const int r, const int e, const int sd, const int Direction) const;
+		//Postcondition: Return the position of the variable of the virtual edge e of the request r on the link sd in the direction
+		//    Direction, the link, start index and spectrum end index variables are in this order
+
+		int core(const int r, const int c, const int sd, const int Direction) const;
+		//Postcondition: Return the position of X_r_c on the link sd in the direction Direction
+
+		int slot(const int r, const int slot, const int e, const int sd, const int Direction) const;
+		//Postcondition: Return the position of t_r_slot_e on the link sd in the direction Direction
+
+		~VarIndex();
+
+	private:
+		//The start positions and sizes of the variables of a request, kept together to be read by one cache line:
+		struct RequestIndex
+		{
+			int _node_start;
+			int _edge_start;
+			int _slot_start;
+			int _vertex_number;
+			int _edge_number;
+			int _bandwidth;
+		};
+
+		int _substrate_vertex_number;
+		int _substrate_edge_number;
+		int _core_number;
+		vector<RequestIndex> _request;
+	};
+
+	//The positions are computed in the innermost loops of the constraints, so they are defined here to be inlined:
+	inline int VarIndex::node(const int r, const int v, const int s) const
+	{
+		assert((r >= 1) && (r <= static_cast<int>(_request.size())));
+		const RequestIndex& Request = _request[r - 1];
+		assert((v >= 1) && (v <= Request._vertex_number) && (s >= 1) && (s <= _substrate_vertex_number));
+		return Request._node_start + (v - 1) * _substrate_vertex_number + (s - 1);
+	}
+
+	inline int VarIndex::edge(const int r, const int e, const int sd, const int Direction) const
+	{
+		assert((r >= 1) && (r <= static_cast<int>(_request.size())));
+		const RequestIndex& Request = _request[r - 1];
+		assert((e >= 1) && (e <= Request._edge_number) && (sd >= 1) && (sd <= _substrate_edge_number));
+		assert((Direction == 0) || (Direction == 1));
+		return Request._edge_start + (sd - 1) * Request._edge_number * 2 + 2 * (e - 1) + Direction;
+	}
+
+	inline int VarIndex::core(const int r, const int c, const int sd, const int Direction) const
+	{
+		assert((r >= 1) && (r <= static_cast<int>(_request.size())));
+		assert((c >= 1) && (c <= _core_number) && (sd >= 1) && (sd <= _substrate_edge_number));
+		assert((Direction == 0) || (Direction == 1));
+		return (r - 1) * _core_number * 2 * _substrate_edge_number + (sd - 1) * _core_number * 2 + 2 * (c - 1) + Direction;
+	}
+
+	inline int VarIndex::slot(const int r, const int slot, const int e, const int sd, const int Direction) const
+	{
+		assert((r >= 1) && (r <= static_cast<int>(_request.size())));
+		const RequestIndex& Request = _request[r - 1];
+		assert((slot >= 1) && (slot <= Request._bandwidth) && (e >= 1) && (e <= Request._edge_number));
+		assert((sd >= 1) && (sd <= _substrate_edge_number) && ((Direction == 0) || (Direction == 1)));
+		return Request._slot_start + ((slot - 1) * _substrate_edge_number + (sd - 1)) * Request._edge_number * 2 
+			+ 2 * (e - 1) + Direction;
+	}
+}
@@ -0,0 +1,290 @@
+//This file defines class TrafficGenerator
+//------------------------------------------------
+//File Name: Generator.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#include "Generator.h"
+
+#include <algorithm>
+#include <charconv>
+#include <chrono>
+#include <random>
+
+namespace
+{
+	char* writeNumber(char* Position, const int Number, const char Separator);
+	//Precondition: There are at least 12 bytes from Position
+	//Postcondition: Number and Separator have been written from Position, and return the position after them
+
+	bool getNumberList(const string& Text, const char Separator, vector<string>& Items);
+	//Postcondition: Items holds the parts of Text between the separators, and return false if one of them is empty
+}
+
+namespace VONETraffic
+{
+	TrafficOption::TrafficOption() :_type_flag(2), _request_number(5000), _seed(1), _hotspot_ratio(0), _buffer_size(1 << 24)
+	{
+
+	}
+
+	TrafficGenerator::TrafficGenerator() :_request_number(0), _written_bytes(0), _generate_time(0)
+	{
+
+	}
+
+	int TrafficGenerator::generate(const VONETopo::Topo& Substrate_Network, const TrafficOption& Option, FILE* Output)
+	{
+		chrono::steady_clock::time_point generate_start = chrono::steady_clock::now();
+		VONETopo::NodeList Substrate_Network_Node;
+		Substrate_Network.get_vertex(Substrate_Network_Node);
+		_vertex.clear();
+		for (VONETopo::NodeListIT NodeIT = Substrate_Network_Node.begin(); NodeIT != Substrate_Network_Node.end(); NodeIT++)
+		{
+			_vertex.push_back(NodeIT->_vertex_id);
+		}
+		if ((_vertex.size() < 2) || !get_bandwidth(Option) || !get_hotspot(Substrate_Network, Option))
+		{
+			return -1;
+		}
+
+		//Each 64-bit random number gives two 32-bit draws, and a draw r of n values is (r * n) >> 32, whose bias is at most
+		//    n / 2^32. The two ends are the two halves of one number, and so are the hotspot flags of the two ends:
+		mt19937_64 Generator(Option._seed);
+		uint64_t Vertex_Number = _vertex.size();
+		uint64_t Hotspot_Number = _hotspot.size();
+		uint64_t Hotspot_Threshold = static_cast<uint64_t>(Option._hotspot_ratio * 4294967296.0);
+		bool Hotspot_Flag = Option._hotspot_ratio > 0;
+
+		//A line has 4 numbers of at most 11 characters and their separators:
+		const size_t Line_Bytes = 48;
+		vector<char> Buffer(max(Option._buffer_size, Line_Bytes));
+		char* Position = Buffer.data();
+		char* Flush_Position = Buffer.data() + Buffer.size() - Line_Bytes;
+		_request_number = 0;
+		_written_bytes = 0;
+		for (long long i = 1; i <= Option._request_number; i++)
+		{
+			uint64_t Ends = Generator();
+			uint64_t Flags = Hotspot_Flag ? Generator() : ~0ULL;
+			int Source = static_cast<int>((Flags & 0xFFFFFFFF) < Hotspot_Threshold ?
+				_hotspot[((Ends & 0xFFFFFFFF) * Hotspot_Number) >> 32] : ((Ends & 0xFFFFFFFF) * Vertex_Number) >> 32);
+			int Destination = static_cast<int>((Flags >> 32) < Hotspot_Threshold ?
+				_hotspot[((Ends >> 32) * Hotspot_Number) >> 32] : ((Ends >> 32) * Vertex_Number) >> 32);
+			if (Destination == Source)
+			{
+				//Any other vertex is drawn uniformly by skipping the source:
+				Destination = static_cast<int>(((Generator() >> 32) * (Vertex_Number - 1)) >> 32);
+				Destination += Destination >= Source ? 1 : 0;
+			}
+
+			//The slot is drawn from the alias table by the high half and kept or replaced by its alias by the low half:
+			uint64_t Slot_Draw = Generator();
+			size_t Slot = static_cast<size_t>(((Slot_Draw >> 32) * _slot.size()) >> 32);
+			Slot = (Slot_Draw & 0xFFFFFFFF) < _slot_threshold[Slot] ? Slot : _slot_alias[Slot];
+
+			Position = writeNumber(Position, _vertex[Source], ' ');
+			Position = writeNumber(Position, _vertex[Destination], ' ');
+			Position = writeNumber(Position, Option._type_flag, ' ');
+			Position = writeNumber(Position, _slot[Slot], '\n');
+			if (Position > Flush_Position)
+			{
+				size_t Bytes = static_cast<size_t>(Position - Buffer.data());
+				if (fwrite(Buffer.data(), 1, Bytes, Output) != Bytes)
+				{
+					return -2;
+				}
+				_written_bytes += Bytes;
+				Position = Buffer.data();
+			}
+			_request_number++;
+		}
+
+		size_t Bytes = static_cast<size_t>(Position - Buffer.data());
+		if ((fwrite(Buffer.data(), 1, Bytes, Output) != Bytes) || (fflush(Output) != 0))
+		{
+			return -2;
+		}
+		_written_bytes += Bytes;
+		_generate_time = chrono::duration<double, milli>(chrono::steady_clock::now() - generate_start).count();
+		return 0;
+	}
+
+	bool TrafficGenerator::get_bandwidth(const TrafficOption& Option)
+	{
+		string Bandwidth = Option._bandwidth;
+		if (Bandwidth.empty())
+		{
+			Bandwidth = Option._type_flag == 0 ? "1-5" : (Option._type_flag == 1 ? "1" : "1-32");
+		}
+
+		_slot.clear();
+		_slot_weight.clear();
+		vector<string> Items;
+		try
+		{
+			if (Bandwidth.find('-') != string::npos)
+			{
+				if (!getNumberList(Bandwidth, '-', Items) || (Items.size() != 2))
+				{
+					return false;
+				}
+				for (int Slot = stoi(Items[0]); Slot <= stoi(Items[1]); Slot++)
+				{
+					_slot.push_back(Slot);
+					_slot_weight.push_back(1);
+				}
+			}
+			else
+			{
+				if (!getNumberList(Bandwidth, ',', Items))
+				{
+					return false;
+				}
+				for (vector<string>::const_iterator ItemIT = Items.begin(); ItemIT != Items.end(); ItemIT++)
+				{
+					size_t Colon = ItemIT->find(':');
+					_slot.push_back(stoi(ItemIT->substr(0, Colon)));
+					_slot_weight.push_back(Colon == string::npos ? 1 : stod(ItemIT->substr(Colon + 1)));
+				}
+			}
+		}
+		catch (...)
+		{
+			return false;
+		}
+
+		//A request has one slot at least, and the weights can not be all 0:
+		double Weight_Sum = 0;
+		for (size_t i = 0; i < _slot.size(); i++)
+		{
+			if ((_slot[i] < 1) || (_slot_weight[i] < 0))
+			{
+				return false;
+			}
+			Weight_Sum += _slot_weight[i];
+		}
+		if (Weight_Sum <= 0)
+		{
+			return false;
+		}
+
+		//Vose's alias method: each slot keeps Scaled[i] of its column of the table and gives the rest to its alias, which is a
+		//    slot of a probability above the mean:
+		size_t Slot_Number = _slot.size();
+		vector<double> Scaled(Slot_Number);
+		vector<size_t> Small, Large;
+		for (size_t i = 0; i < Slot_Number; i++)
+		{
+			Scaled[i] = _slot_weight[i] / Weight_Sum * Slot_Number;
+			(Scaled[i] < 1 ? Small : Large).push_back(i);
+		}
+		_slot_alias.assign(Slot_Number, 0);
+		_slot_threshold.assign(Slot_Number, 0xFFFFFFFFULL + 1);
+		while (!Small.empty() && !Large.empty())
+		{
+			size_t Less = Small.back(), More = Large.back();
+			Small.pop_back();
+			_slot_threshold[Less] = static_cast<uint64_t>(Scaled[Less] * 4294967296.0);
+			_slot_alias[Less] = static_cast<int>(More);
+			Scaled[More] -= 1 - Scaled[Less];
+			if (Scaled[More] < 1)
+			{
+				Large.pop_back();
+				Small.push_back(More);
+			}
+		}
+		return true;
+	}
+
+	bool TrafficGenerator::get_hotspot(const VONETopo::Topo& Substrate_Network, const TrafficOption& Option)
+	{
+		_hotspot.clear();
+		if (Option._hotspot.empty())
+		{
+			//The vertex with the most links, the first one for the same number:
+			VONETopo::LinkList Substrate_Network_Edge;
+			Substrate_Network.get_edge(Substrate_Network_Edge);
+			vector<int> Degree(_vertex.size(), 0);
+			for (VONETopo::LinkListIT EdgeIT = Substrate_Network_Edge.begin(); EdgeIT != Substrate_Network_Edge.end(); EdgeIT++)
+			{
+				Degree[find(_vertex.begin(), _vertex.end(), EdgeIT->_edge_source._vertex_id) - _vertex.begin()]++;
+				Degree[find(_vertex.begin(), _vertex.end(), EdgeIT->_edge_destination._vertex_id) - _vertex.begin()]++;
+			}
+			_hotspot.push_back(static_cast<int>(max_element(Degree.begin(), Degree.end()) - Degree.begin()));
+			return true;
+		}
+
+		vector<string> Items;
+		if (!getNumberList(Option._hotspot, ',', Items))
+		{
+			return false;
+		}
+		for (vector<string>::const_iterator ItemIT = Items.begin(); ItemIT != Items.end(); ItemIT++)
+		{
+			int Vertex_ID;
+			try
+			{
+				Vertex_ID = stoi(*ItemIT);
+			}
+			catch (...)
+			{
+				return false;
+			}
+			vector<int>::const_iterator VertexIT = find(_vertex.begin(), _vertex.end(), Vertex_ID);
+			if (VertexIT == _vertex.end())
+			{
+				return false;
+			}
+			_hotspot.push_back(static_cast<int>(VertexIT - _vertex.begin()));
+		}
+		return true;
+	}
+
+	ostream& operator <<(ostream& outs, const TrafficGenerator& Generator)
+	{
+		outs << "Requests = " << Generator._request_number << ", Bytes = " << Generator._written_bytes << endl;
+		outs << "Generating Time = " << Generator._generate_time << "ms, Requests per Second = "
+			<< (Generator._generate_time > 0 ? Generator._request_number / Generator._generate_time * 1000 : 0)
+			<< ", MB per Second = " << (Generator._generate_time > 0 ? Generator._written_bytes / Generator._generate_time / 1000 : 0)
+			<< endl;
+		return outs;
+	}
+
+	TrafficGenerator::~TrafficGenerator()
+	{
+
+	}
+}
+
+namespace
+{
+	char* writeNumber(char* Position, const int Number, const char Separator)
+	{
+		Position = to_chars(Position, Position + 11, Number).ptr;
+		*Position = Separator;
+		return Position + 1;
+	}
+
+	bool getNumberList(const string& Text, const char Separator, vector<string>& Items)
+	{
+		Items.clear();
+		size_t First = 0;
+		while (true)
+		{
+			size_t Last = Text.find(Separator, First);
+			Items.push_back(Text.substr(First, Last == string::npos ? string::npos : Last - First));
+			if (Items.back().empty())
+			{
+				return false;
+			}
+			if (Last == string::npos)
+			{
+				return true;
+			}
+			First = Last + 1;
+		}
+	}
+}
@@ -0,0 +1,70 @@
+//This file declares class TrafficGenerator
+//------------------------------------------------
+//File Name: Generator.h
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#pragma once
+#include "../TDMWDMOFDMonMCF/Topo.h"
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+namespace VONETraffic
+{
+	//The options of the generated requests, the default values are those of the traffic files of TDMWDMOFDMonMCF
+	struct TrafficOption
+	{
+		TrafficOption();
+
+		int _type_flag;				//0 is tdm, 1 is wdm and 2 is ofdm
+		long long _request_number;
+		unsigned int _seed;
+		string _bandwidth;			//"Min-Max" for the slots uniform from Min to Max, or "Slot:Weight,Slot:Weight,..." for the
+									//    slots in proportion to the weights (1 if a weight is not given), empty for the default of
+									//    the type: 1-5 for tdm, 1 for wdm and 1-32 for ofdm
+		double _hotspot_ratio;		//An end of a request is a hotspot vertex with this probability, otherwise any vertex
+		string _hotspot;			//"Vertex,Vertex,..." for the hotspot vertexes, empty for the vertex with the most links
+		size_t _buffer_size;		//The bytes of the buffer of the written lines
+	};
+
+	//Generate the requests of the traffic file format "Source Destination Type Slots" on the vertexes of a topology
+	class TrafficGenerator
+	{
+	public:
+		TrafficGenerator();
+
+		int generate(const VONETopo::Topo& Substrate_Network, const TrafficOption& Option, FILE* Output);
+		//Precondition: The topology has been assigned and has two vertexes at least, Output is opened for writing in binary
+		//Postcondition: Return 0 after Option._request_number lines of requests are written to Output, -1 if the bandwidth or the
+		//    hotspot vertexes of Option are wrong, -2 if Output can not be written
+
+		friend ostream& operator <<(ostream& outs, const TrafficGenerator& Generator);
+		//Precondition: outs has been connected to an out stream
+		//Postcondition: Print the statistics of the generation to outs
+
+		~TrafficGenerator();
+
+	private:
+		bool get_bandwidth(const TrafficOption& Option);
+		//Postcondition: Return false if Option._bandwidth is wrong, otherwise _slot and _slot_weight hold the slots and their weights,
+		//    and _slot_alias and _slot_threshold hold the alias table of the weights
+
+		bool get_hotspot(const VONETopo::Topo& Substrate_Network, const TrafficOption& Option);
+		//Postcondition: Return false if a vertex of Option._hotspot is not in the topology, otherwise _hotspot holds the vertexes
+
+		vector<int> _vertex;
+		vector<int> _hotspot;
+		vector<int> _slot;
+		vector<double> _slot_weight;
+		vector<int> _slot_alias;
+		vector<uint64_t> _slot_threshold;	//A column keeps its slot if the low 32 bits of the draw are below the threshold
+
+		//Statistics of the generation, the time is the wall time in ms:
+		long long _request_number;
+		long long _written_bytes;
+		double _generate_time;
+	};
+}
@@ -0,0 +1,153 @@
+//This file is the main function of the traffic generator of TDM, WDM or OFDM on MCF.
+//------------------------------------------------
+//File Name: TrafficGenerator.cpp
+//Author: Qihan Zhang
+//Email: lengkudaodi@outlook.com
+//Last Modified: Oct. 17th 2026
+//------------------------------------------------
+
+#include "Generator.h"
+#include <fstream>
+#include <cstring>
+
+namespace
+{
+	static void Usage(const char* ProgramName);
+}
+
+//***************Program entry***************//
+//MainError Code which is the retrun integer value of the main function can indicate the mistake details
+//when debug the program:
+//0: There are no errors during the executing;
+//-1: The number of program arguments is wrong, may be not enough or too much;
+//-2: One of the name of the arguments is wrong;
+//-3: The topology file fails to read;
+//-4: The wrong code usage of the type of the service, check that 0 is tdm, 1 is wdm and 2 is ofdm;
+//-5: The traffic file fails to open or write;
+//-6: The bandwidth or the hotspot vertexes are wrong.
+int main(int argc, char **argv)
+{
+	int MainError = 0;
+	string TopoFileName, TrafficFileName;
+	VONETraffic::TrafficOption Option;
+	Option._type_flag = -1;
+	Option._request_number = -1;
+	if ((argc == 2) && ((strcmp(argv[1], "-h") == 0) || (strcmp(argv[1], "-help") == 0)))
+	{
+		Usage(argv[0]);
+		exit(1);
+	}
+	if ((argc < 9) || (argc % 2 == 0))
+	{
+		Usage(argv[0]);
+		exit(1);
+	}
+
+	for (int i = 2; i <= argc; i = i + 2)
+	{
+		if ((strcmp(argv[i - 1], "-k") == 0) || (strcmp(argv[i - 1], "-type") == 0))
+			Option._type_flag = stoi(argv[i + 1 - 1]);
+		else if ((strcmp(argv[i - 1], "-t") == 0) || (strcmp(argv[i - 1], "-topo") == 0))
+			TopoFileName = argv[i + 1 - 1];
+		else if ((strcmp(argv[i - 1], "-r") == 0) || (strcmp(argv[i - 1], "-rnum") == 0))
+			Option._request_number = stoll(argv[i + 1 - 1]);
+		else if ((strcmp(argv[i - 1], "-s") == 0) || (strcmp(argv[i - 1], "-traffic") == 0))
+			TrafficFileName = argv[i + 1 - 1];
+		else if ((strcmp(argv[i - 1], "-b") == 0) || (strcmp(argv[i - 1], "-bandwidth") == 0))
+			Option._bandwidth = argv[i + 1 - 1];
+		else if ((strcmp(argv[i - 1], "-p") == 0) || (strcmp(argv[i - 1], "-ratio") == 0))
+			Option._hotspot_ratio = stod(argv[i + 1 - 1]);
+		else if ((strcmp(argv[i - 1], "-o") == 0) || (strcmp(argv[i - 1], "-hotspot") == 0))
+			Option._hotspot = argv[i + 1 - 1];
+		else if ((strcmp(argv[i - 1], "-z") == 0) || (strcmp(argv[i - 1], "-seed") == 0))
+			Option._seed = static_cast<unsigned int>(stoul(argv[i + 1 - 1]));
+		else
+		{
+			cerr << "Wrong argument name!\n";
+			MainError = -2;
+			exit(1);
+		}
+	}
+
+	if ((Option._type_flag < 0) || TopoFileName.empty() || (Option._request_number < 0) || TrafficFileName.empty()
+		|| (Option._hotspot_ratio < 0) || (Option._hotspot_ratio > 1))
+	{
+		Usage(argv[0]);
+		MainError = -1;
+		exit(1);
+	}
+	if (Option._type_flag > 2)
+	{
+		cerr << "Wrong type of service!\n";
+		MainError = -4;
+		exit(1);
+	}
+
+	//Input the Substrate Network:
+	VONETopo::Topo Substrate_Network;
+	ifstream topoinput;
+	topoinput.open(TopoFileName.c_str());
+	if (topoinput.fail())
+	{
+		cerr << "Topo input file opened failed.\n";
+		MainError = -3;
+		exit(1);
+	}
+	topoinput >> Substrate_Network;
+	topoinput.close();
+
+	//The lines are written in binary, so they end with '\n' like the traffic files on all platforms:
+	FILE* output = fopen(TrafficFileName.c_str(), "wb");
+	if (output == NULL)
+	{
+		cerr << "Traffic file opened failed.\n";
+		MainError = -5;
+		exit(1);
+	}
+
+	VONETraffic::TrafficGenerator Generator;
+	int generateerror = Generator.generate(Substrate_Network, Option, output);
+	fclose(output);
+	if (generateerror == -1)
+	{
+		cerr << "Wrong bandwidth or hotspot vertexes!\n";
+		MainError = -6;
+		exit(1);
+	}
+	else if (generateerror == -2)
+	{
+		cerr << "Traffic file written failed.\n";
+		MainError = -5;
+		exit(1);
+	}
+
+	cout << Generator;
+
+	return MainError;
+}
+
+namespace
+{
+	static void Usage(const char* ProgramName)
+	{
+		cerr << "\nUsage: " << ProgramName << " -help/-h to elaborate the reference of the program.\n";
+		cerr << "\nRight usage of " << ProgramName << " is like the following: \n";
+		cerr << ProgramName << " -type/-k 2 -topo/-t 'OFDMNSFNET.txt' -rnum/-r 5000 -traffic/-s 'ofdm5000.txt'\n";
+		cerr << "\nWhere -type/-k <Type of the Traffic> is an integer to indicate the type of this traffic."
+			<< " 0 is tdm, 1 is wdm and 2 is ofdm.\n";
+		cerr << "\nWhere -topo/-t <Name of the Topology File> is a string to describe the file of the input topology.\n";
+		cerr << "\nWhere -rnum/-r <Number of Traffic> is an integer to indicate the number of the generated requests.\n";
+		cerr << "\nWhere -traffic/-s <Name of the Traffic File> is a string to describe the file of the output traffic.\n";
+		cerr << "\nThe arguments above must be enough, or the program will be exit with error code -1.\n";
+		cerr << "\nThe following arguments are optional and can be appended after the arguments above:\n";
+		cerr << "\nWhere -bandwidth/-b <Bandwidth> is a string to describe the slots of a request. Min-Max like 1-32 draws them"
+			<< " uniformly from Min to Max, and Slot:Weight,Slot:Weight like 1:3,4:1 draws them in proportion to the weights."
+			<< " The default is 1-5 for tdm, 1 for wdm and 1-32 for ofdm, the same as the traffic files.\n";
+		cerr << "\nWhere -ratio/-p <Hotspot Ratio> is a number from 0 to 1 to indicate the probability that the source or the"
+			<< " destination of a request is a hotspot vertex, otherwise it is any vertex. 0 is the default, which is uniform.\n";
+		cerr << "\nWhere -hotspot/-o <Hotspot Vertexes> is a list of vertexes like 3,7 to indicate the hotspot vertexes. The vertex"
+			<< " with the most links is the default.\n";
+		cerr << "\nWhere -seed/-z <Seed> is an integer to indicate the seed of the random numbers, the same seed generates the same"
+			<< " file. 1 is the default.\n" << endl;
+	}
+}